@@ -0,0 +1,81 @@
+#include "src/DoublyLinkedList.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_alloc.cpp src/DoublyLinkedList.cpp -o bench_alloc
+
+Counts heap allocations per call for DoublyLinkedList<string> with strings
+too long for the small-string buffer. Node memory comes from the pool, so
+after warm-up the only allocations left are the strings themselves: one
+for an lvalue insert (taking T by value used to cost two), one for an
+emplace that builds a new string, none for a move or a lookup.
+*/
+
+static long allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    ++allocations;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+template <typename Fn>
+static void report(const char *name, int calls, Fn fn)
+{
+    long before = allocations;
+    fn();
+    std::printf("%-28s %8.2f\n", name, double(allocations - before) / calls);
+}
+
+int main()
+{
+    const int N = 100000;
+    const string value(64, 'x');
+    std::vector<string> pending(N, value);
+
+    DoublyLinkedList<string> list;
+    // Warm the pool so page allocations do not blur the numbers
+    for (int i = 0; i < 2 * N; ++i)
+        list.emplaceAtTail();
+    list.clear();
+
+    std::printf("%-28s %8s\n", "operation", "allocs/op");
+    report("insertAtTail(lvalue)", N, [&] {
+        for (int i = 0; i < N; ++i)
+            list.insertAtTail(value);
+    });
+    list.clear();
+    report("insertAtTail(std::move)", N, [&] {
+        for (int i = 0; i < N; ++i)
+            list.insertAtTail(std::move(pending[i]));
+    });
+    list.clear();
+    report("emplaceAtTail(64, 'x')", N, [&] {
+        for (int i = 0; i < N; ++i)
+            list.emplaceAtTail(64, 'x');
+    });
+    report("contains(lvalue)", 100, [&] {
+        bool found = true;
+        for (int i = 0; i < 100; ++i)
+            found &= list.contains(value);
+        if (!found)
+            std::exit(1);
+    });
+    return 0;
+}
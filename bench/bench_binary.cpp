@@ -0,0 +1,74 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_binary.cpp src/DoublyLinkedList.cpp -o bench_binary
+
+Warm start for a list of Points: writing and reloading the binary snapshot
+against the text route (toString out, then parsing "(x,y,z)" back in).
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static DoublyLinkedList<Point> parseText(const string &text)
+{
+    DoublyLinkedList<Point> list;
+    std::istringstream in(text);
+    char c;
+    in >> c; // '['
+    double x, y, z;
+    while (in >> c && c == '(' && in >> x >> c >> y >> c >> z >> c)
+    {
+        list.insertAtTail(Point(x, y, z));
+        in >> c; // ',' or ']'
+    }
+    return list;
+}
+
+int main()
+{
+    string dir = std::filesystem::temp_directory_path().string();
+    string binPath = dir + "/bench_points.bin";
+    string textPath = dir + "/bench_points.txt";
+
+    std::printf("%10s %12s %12s %12s %12s\n", "points", "save bin", "load bin", "save text", "load text");
+    for (int n = 10000; n <= 1000000; n *= 10)
+    {
+        DoublyLinkedList<Point> list;
+        for (int i = 0; i < n; ++i)
+            list.insertAtTail(Point(i * 0.5, -i / 7.0, i % 100));
+
+        auto t0 = std::chrono::steady_clock::now();
+        list.saveBinary(binPath);
+        double saveBin = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        DoublyLinkedList<Point> loaded = DoublyLinkedList<Point>::loadBinary(binPath);
+        double loadBin = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        std::ofstream(textPath) << list.toString();
+        double saveText = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        std::ifstream in(textPath);
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        DoublyLinkedList<Point> parsed = parseText(contents.str());
+        double loadText = msSince(t0);
+
+        if (loaded.size() != n || parsed.size() != n)
+            return 1;
+        std::printf("%10d %10.2fms %10.2fms %10.2fms %10.2fms\n", n, saveBin, loadBin, saveText, loadText);
+    }
+    std::remove(binPath.c_str());
+    std::remove(textPath.c_str());
+    return 0;
+}
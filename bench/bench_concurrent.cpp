@@ -0,0 +1,105 @@
+#include "src/ConcurrentDoublyLinkedList.h"
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -pthread -I. -Isrc bench/bench_concurrent.cpp src/ConcurrentDoublyLinkedList.cpp src/DoublyLinkedList.cpp -o bench_concurrent
+
+Usage: ./bench_concurrent [max_threads]
+
+Each thread runs a mix of insertAtHead, insertAtTail and deleteAt near
+the front of a shared list. The baseline is DoublyLinkedList behind one
+global mutex. Throughput is in million operations per second.
+*/
+
+const int OPS_PER_THREAD = 200000;
+
+template <typename Insert, typename Delete>
+static double run(int threads, Insert insert, Delete erase)
+{
+    std::vector<std::thread> workers;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([=] {
+            unsigned seed = 977u * (t + 1);
+            for (int i = 0; i < OPS_PER_THREAD; ++i)
+            {
+                seed = seed * 1103515245u + 12345u;
+                unsigned r = (seed >> 16) % 10;
+                if (r < 4)
+                    insert(true, i);
+                else if (r < 8)
+                    insert(false, i);
+                else
+                    erase(int((seed >> 8) % 16));
+            }
+        });
+    }
+    for (std::thread &w : workers)
+        w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return threads * double(OPS_PER_THREAD) / seconds / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : int(std::thread::hardware_concurrency());
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    std::printf("%8s %18s %18s\n", "threads", "global mutex", "per-node locks");
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        DoublyLinkedList<int> plain;
+        std::mutex plainLock;
+        ConcurrentDoublyLinkedList<int> concurrent;
+        for (int i = 0; i < 1000; ++i)
+        {
+            plain.insertAtTail(i);
+            concurrent.insertAtTail(i);
+        }
+
+        double locked = run(
+            threads,
+            [&](bool atHead, int v) {
+                std::lock_guard<std::mutex> guard(plainLock);
+                if (atHead)
+                    plain.insertAtHead(v);
+                else
+                    plain.insertAtTail(v);
+            },
+            [&](int index) {
+                std::lock_guard<std::mutex> guard(plainLock);
+                if (index < plain.size())
+                    plain.deleteAt(index);
+            });
+        double fine = run(
+            threads,
+            [&](bool atHead, int v) {
+                if (atHead)
+                    concurrent.insertAtHead(v);
+                else
+                    concurrent.insertAtTail(v);
+            },
+            [&](int index) {
+                try
+                {
+                    concurrent.deleteAt(index);
+                }
+                catch (const std::out_of_range &)
+                {
+                }
+            });
+        std::printf("%8d %14.2f M/s %14.2f M/s\n", threads, locked, fine);
+        if (threads * 2 > maxThreads && threads != maxThreads)
+            threads = maxThreads / 2; // finish on maxThreads itself
+    }
+    return 0;
+}
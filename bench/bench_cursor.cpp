@@ -0,0 +1,61 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_cursor.cpp src/DoublyLinkedList.cpp -o bench_cursor
+
+Local index access on a 10^5-element list: a get(i), get(i+1),
+insertAt(i+2), deleteAt(i+2) sweep over the whole list (each call starts
+from the node the previous one reached), the same edits through a Cursor,
+and a plain iterator read for reference. Without the position cache the
+sweep is quadratic: every call walked from the nearer sentinel.
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const int N = 100000;
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < N; ++i)
+        list.insertAtTail(i);
+
+    long long sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i + 2 < N; ++i)
+    {
+        sink += list.get(i) + list.get(i + 1);
+        list.insertAt(i + 2, -1);
+        list.deleteAt(i + 2);
+    }
+    double indexedMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    auto cursor = list.cursor();
+    for (int i = 0; i + 2 < N; ++i)
+    {
+        sink += cursor.get();
+        cursor.moveNext();
+        sink += cursor.get();
+        cursor.moveNext();
+        cursor.insert(-1);
+        cursor.movePrev();
+        cursor.erase();
+        cursor.movePrev();
+    }
+    double cursorMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (int value : list)
+        sink += value;
+    double iterMs = msSince(t0);
+
+    std::printf("index sweep  %8.2f ms\ncursor sweep %8.2f ms\niterator     %8.2f ms (sink %lld)\n", indexedMs,
+                cursorMs, iterMs, sink);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include "src/DoublyLinkedList.h"
+#include "src/LockFreeDeque.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -pthread -I. -Isrc bench/bench_deque.cpp src/LockFreeDeque.cpp src/EpochReclaimer.cpp src/DoublyLinkedList.cpp -o bench_deque
+
+Usage: ./bench_deque [max_threads]
+
+Work-queue pattern: half the threads push at the back, half pop from the
+front. The baseline is DoublyLinkedList behind a mutex, used the way our
+consumers do today (insertAtTail, then get(0) + deleteAt(0)). Throughput is
+in million items moved per second.
+*/
+
+const int ITEMS_PER_PRODUCER = 500000;
+
+template <typename Push, typename Pop>
+static double run(int threads, Push push, Pop pop)
+{
+    int producers = threads > 1 ? threads / 2 : 1;
+    int consumers = threads > 1 ? threads - producers : 1;
+    long long total = (long long)producers * ITEMS_PER_PRODUCER;
+    std::atomic<long long> consumed(0);
+    std::vector<std::thread> workers;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int p = 0; p < producers; ++p)
+    {
+        workers.emplace_back([=] {
+            for (int i = 0; i < ITEMS_PER_PRODUCER; ++i)
+                push(i);
+        });
+    }
+    for (int c = 0; c < consumers; ++c)
+    {
+        workers.emplace_back([&] {
+            int value;
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                if (pop(value))
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (std::thread &w : workers)
+        w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return total / seconds / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : int(std::thread::hardware_concurrency());
+    if (maxThreads < 2)
+        maxThreads = 2;
+
+    std::printf("%8s %18s %18s\n", "threads", "mutex + list", "lock-free deque");
+    for (int threads = 2; threads <= maxThreads; threads *= 2)
+    {
+        DoublyLinkedList<int> list;
+        std::mutex listLock;
+        double locked = run(
+            threads,
+            [&](int v) {
+                std::lock_guard<std::mutex> guard(listLock);
+                list.insertAtTail(v);
+            },
+            [&](int &out) {
+                std::lock_guard<std::mutex> guard(listLock);
+                if (list.size() == 0)
+                    return false;
+                out = list.get(0);
+                list.deleteAt(0);
+                return true;
+            });
+
+        LockFreeDeque<int> deque;
+        double lockFree = run(
+            threads,
+            [&](int v) { deque.pushBack(v); },
+            [&](int &out) { return deque.popFront(out); });
+
+        std::printf("%8d %14.2f M/s %14.2f M/s\n", threads, locked, lockFree);
+    }
+    return 0;
+}
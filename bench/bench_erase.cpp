@@ -0,0 +1,71 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_erase.cpp src/DoublyLinkedList.cpp -o bench_erase
+
+Removes every odd element. The index-based loop re-walks the list for each
+deleteAt and is quadratic, so it only runs up to 10^5 elements; eraseIf and
+the erase(Iterator) loop are single passes.
+*/
+
+static DoublyLinkedList<int> makeList(int n)
+{
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < n; ++i)
+        list.insertAtTail(i);
+    return list;
+}
+
+int main()
+{
+    std::printf("%10s %18s %18s %18s\n", "size", "deleteAt (ms)", "erase loop (ms)", "eraseIf (ms)");
+    for (int n = 1000; n <= 1000000; n *= 10)
+    {
+        double deleteAtMs = -1;
+        if (n <= 100000)
+        {
+            DoublyLinkedList<int> list = makeList(n);
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < list.size();)
+            {
+                if (list.get(i) % 2)
+                    list.deleteAt(i);
+                else
+                    ++i;
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            deleteAtMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+            if (list.size() != (n + 1) / 2)
+                return 1;
+        }
+
+        DoublyLinkedList<int> looped = makeList(n);
+        auto t0 = std::chrono::steady_clock::now();
+        for (auto it = looped.begin(); it != looped.end();)
+        {
+            if (*it % 2)
+                it = looped.erase(it);
+            else
+                ++it;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+
+        DoublyLinkedList<int> filtered = makeList(n);
+        auto t2 = std::chrono::steady_clock::now();
+        filtered.eraseIf([](int x) { return x % 2 != 0; });
+        auto t3 = std::chrono::steady_clock::now();
+
+        if (looped.size() != (n + 1) / 2 || filtered.size() != (n + 1) / 2)
+            return 1;
+        double loopMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        double eraseIfMs = std::chrono::duration<double, std::milli>(t3 - t2).count();
+        if (deleteAtMs < 0)
+            std::printf("%10d %18s %18.2f %18.2f\n", n, "-", loopMs, eraseIfMs);
+        else
+            std::printf("%10d %18.2f %18.2f %18.2f\n", n, deleteAtMs, loopMs, eraseIfMs);
+    }
+    return 0;
+}
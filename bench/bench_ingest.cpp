@@ -0,0 +1,68 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_ingest.cpp src/DoublyLinkedList.cpp -o bench_ingest
+
+Building a list of N ints. From memory: one insertAtTail per element versus
+appendRange. From text: getline + stoi + insertAtTail versus appendDelimited,
+which parses with from_chars straight into the nodes.
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const int N = 5000000;
+    std::vector<int> values(N);
+    string text;
+    for (int i = 0; i < N; ++i)
+    {
+        values[i] = i * 13 - 1000;
+        text += std::to_string(values[i]);
+        text += '\n';
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    DoublyLinkedList<int> perElement;
+    for (int v : values)
+        perElement.insertAtTail(v);
+    double perElementMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    DoublyLinkedList<int> batched;
+    batched.appendRange(values.begin(), values.end());
+    double batchedMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    DoublyLinkedList<int> lineByLine;
+    {
+        std::istringstream in(text);
+        string line;
+        while (std::getline(in, line))
+            lineByLine.insertAtTail(std::stoi(line));
+    }
+    double lineMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    DoublyLinkedList<int> parsed;
+    {
+        std::istringstream in(text);
+        parsed.appendDelimited(in);
+    }
+    double parsedMs = msSince(t0);
+
+    if (perElement.size() != N || batched.size() != N || lineByLine.size() != N || parsed.size() != N)
+        return 1;
+    std::printf("%d ints\n", N);
+    std::printf("  from memory: insertAtTail loop %8.1f ms   appendRange      %8.1f ms\n", perElementMs, batchedMs);
+    std::printf("  from text:   getline + stoi    %8.1f ms   appendDelimited  %8.1f ms\n", lineMs, parsedMs);
+    return 0;
+}
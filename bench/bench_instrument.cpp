@@ -0,0 +1,59 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/*
+Build (once per mode; every file must see the same flags):
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_instrument.cpp src/DoublyLinkedList.cpp -o bench_plain
+    ! g++ -std=c++17 -O2 -DDLL_INSTRUMENT -I. -Isrc bench/bench_instrument.cpp src/DoublyLinkedList.cpp -o bench_counted
+    ! g++ -std=c++17 -O2 -DDLL_INSTRUMENT_LATENCY -I. -Isrc bench/bench_instrument.cpp src/DoublyLinkedList.cpp -o bench_timed
+
+Cost of the instrumentation modes on a mixed workload: cheap O(1) ends
+(where counting overhead shows most) and random get/insertAt/deleteAt on a
+10^5-element list. Prints the stats() report, whose walk histograms show
+how far index-based access really travels.
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const int N = 100000;
+    const int ENDS = 10000000;
+    const int RANDOM_OPS = 2000;
+    DoublyLinkedList<int> list;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ENDS; ++i)
+    {
+        list.insertAtTail(i);
+        list.deleteAt(0);
+    }
+    double endsMs = msSince(t0);
+
+    for (int i = 0; i < N; ++i)
+        list.insertAtTail(i);
+    std::uint32_t seed = 2463534242u;
+    long long sink = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < RANDOM_OPS; ++i)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        int pos = int(seed % std::uint32_t(list.size()));
+        sink += list.get(pos);
+        list.insertAt(pos, i);
+        list.deleteAt((pos * 7) % list.size());
+    }
+    double randomMs = msSince(t0);
+
+    std::printf("ends: %.1f ms for %d insertAtTail+deleteAt(0) pairs\n", endsMs, ENDS);
+    std::printf("random: %.1f ms for %d get+insertAt+deleteAt rounds (sink %lld)\n", randomMs, RANDOM_OPS, sink);
+    std::printf("%s", list.stats().toString().c_str());
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_move.cpp src/DoublyLinkedList.cpp -o bench_move
+
+Moving a list only relinks its first and last node, so the time per move
+must stay flat while the list grows.
+*/
+
+int main()
+{
+    const int ROUNDS = 100000;
+    std::printf("%10s %16s %16s\n", "size", "move ctor (ns)", "move assign (ns)");
+    for (int n = 100; n <= 1000000; n *= 10)
+    {
+        DoublyLinkedList<int> a;
+        for (int i = 0; i < n; ++i)
+            a.insertAtTail(i);
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            DoublyLinkedList<int> b(std::move(a));
+            a = std::move(b);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        DoublyLinkedList<int> c;
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            c = std::move(a);
+            a.swap(c);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        double ctorNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / ROUNDS;
+        double assignNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / ROUNDS;
+        std::printf("%10d %16.1f %16.1f\n", n, ctorNs, assignNs);
+        if (a.size() != n)
+            return 1;
+    }
+    return 0;
+}
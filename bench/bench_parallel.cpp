@@ -0,0 +1,82 @@
+#include "src/DoublyLinkedList.h"
+#include "src/ThreadPool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -pthread -I. -Isrc bench/bench_parallel.cpp src/DoublyLinkedList.cpp src/ThreadPool.cpp -o bench_parallel
+
+Usage: ./bench_parallel [max_threads]
+
+Speedup of the parallel list algorithms on 10^7 elements relative to a
+plain iterator loop: summing doubles, translating Points and counting with
+a predicate. Each parallel time includes the O(n) split pass.
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    const int N = 10000000;
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : int(std::thread::hardware_concurrency());
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    DoublyLinkedList<double> values;
+    DoublyLinkedList<Point> points;
+    for (int i = 0; i < N; ++i)
+    {
+        values.insertAtTail(i * 1e-3);
+        points.insertAtTail(Point(i, -i, 0));
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    double serialSum = 0;
+    for (double v : values)
+        serialSum += v;
+    double sumSerialMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (Point &p : points)
+        p.translate(1, 1, 1);
+    double translateSerialMs = msSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    int serialCount = 0;
+    for (double v : values)
+        serialCount += v > 5000.0;
+    double countSerialMs = msSince(t0);
+
+    std::printf("serial: reduce %.1f ms, transform %.1f ms, countIf %.1f ms\n", sumSerialMs, translateSerialMs, countSerialMs);
+    std::printf("%8s %18s %18s %18s\n", "threads", "reduce speedup", "transform speedup", "countIf speedup");
+    for (int threads = 1; threads <= maxThreads; threads = threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2)
+    {
+        ThreadPool pool(threads);
+
+        t0 = std::chrono::steady_clock::now();
+        double sum = values.parallelReduce(pool, 0.0, [](double a, double b) { return a + b; });
+        double sumMs = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        points.parallelTransform(pool, [](const Point &p) { return p + Point(1, 1, 1); });
+        double translateMs = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        int count = values.parallelCountIf(pool, [](double v) { return v > 5000.0; });
+        double countMs = msSince(t0);
+
+        if (count != serialCount || sum < serialSum * 0.999999 || sum > serialSum * 1.000001)
+            return 1;
+        std::printf("%8d %17.2fx %17.2fx %17.2fx\n", threads, sumSerialMs / sumMs, translateSerialMs / translateMs,
+                    countSerialMs / countMs);
+        if (threads == maxThreads)
+            break;
+    }
+    return 0;
+}
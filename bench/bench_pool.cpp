@@ -0,0 +1,58 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+#include <list>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_pool.cpp src/DoublyLinkedList.cpp -o bench_pool
+
+Churn workload: keep a list of `live` elements and repeatedly insert at one
+end and delete at the other. std::list does one new/delete per operation,
+which is what DoublyLinkedList did before it got its node pool.
+*/
+
+template <typename F>
+static double nsPerOp(long ops, F f)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ops;
+}
+
+int main()
+{
+    const long OPS = 5000000;
+    std::printf("%10s %18s %18s\n", "live", "pooled (ns/op)", "new/delete (ns/op)");
+    for (int live = 10; live <= 1000000; live *= 10)
+    {
+        long checksum = 0;
+        double pooled = nsPerOp(OPS, [&]() {
+            DoublyLinkedList<int> list;
+            for (int i = 0; i < live; ++i)
+                list.insertAtTail(i);
+            for (long i = 0; i < OPS / 2; ++i)
+            {
+                list.insertAtTail(int(i));
+                list.deleteAt(0);
+            }
+            checksum += list.get(0);
+        });
+        double plain = nsPerOp(OPS, [&]() {
+            std::list<int> list;
+            for (int i = 0; i < live; ++i)
+                list.push_back(i);
+            for (long i = 0; i < OPS / 2; ++i)
+            {
+                list.push_back(int(i));
+                list.pop_front();
+            }
+            checksum -= list.front();
+        });
+        std::printf("%10d %18.2f %18.2f\n", live, pooled, plain);
+        if (checksum != 0)
+            return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_reverse.cpp src/DoublyLinkedList.cpp -o bench_reverse
+
+reverse() only flips an orientation bit, so its cost must not grow with the
+list. The second column checks that walking a reversed list is as fast as
+walking it in the original direction.
+*/
+
+int main()
+{
+    const int ROUNDS = 1000000;
+    std::printf("%10s %14s %22s %22s\n", "size", "reverse (ns)", "iterate fwd (ns/elem)", "iterate rev (ns/elem)");
+    for (int n = 10; n <= 10000000; n *= 10)
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < n; ++i)
+            list.insertAtTail(i);
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; ++r)
+            list.reverse();
+        auto t1 = std::chrono::steady_clock::now();
+
+        long sum = 0;
+        for (int x : list)
+            sum += x;
+        auto t2 = std::chrono::steady_clock::now();
+        list.reverse();
+        for (int x : list)
+            sum -= x;
+        auto t3 = std::chrono::steady_clock::now();
+
+        double reverseNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / ROUNDS;
+        double fwdNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+        double revNs = std::chrono::duration<double, std::nano>(t3 - t2).count() / n;
+        std::printf("%10d %14.2f %22.2f %22.2f\n", n, reverseNs, fwdNs, revNs);
+        if (sum != 0)
+            return 1;
+    }
+    return 0;
+}
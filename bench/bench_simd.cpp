@@ -0,0 +1,61 @@
+#include "src/DoublyLinkedList.h"
+#include "src/UnrolledLinkedList.h"
+#include "src/SimdSearch.h"
+#include <chrono>
+#include <cstdio>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_simd.cpp src/DoublyLinkedList.cpp src/UnrolledLinkedList.cpp src/SimdSearch.cpp -o bench_simd
+
+Membership checks on 10^7-element lists: a miss has to scan everything.
+"unrolled scalar" runs the same chunk walk with the plain operator== loop.
+*/
+
+template <typename F>
+static double millis(F f)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+template <typename T>
+static void run(const char *type, int n)
+{
+    DoublyLinkedList<T> plain;
+    UnrolledLinkedList<T> unrolled;
+    for (int i = 0; i < n; ++i)
+    {
+        plain.insertAtTail(T(i % 100));
+        unrolled.insertAtTail(T(i % 100));
+    }
+    const T missing = T(101);
+    const T any[] = {T(120), T(110), T(101)};
+    volatile int sink = 0;
+
+    double linked = millis([&]() { sink = sink + plain.contains(missing); });
+    double scalar = millis([&]() {
+        int hits = 0;
+        for (auto it = unrolled.begin(); it != unrolled.end(); ++it)
+            hits += (*it == missing);
+        sink = sink + hits;
+    });
+    double vectorized = millis([&]() { sink = sink + unrolled.contains(missing); });
+    double counted = millis([&]() { sink = sink + unrolled.countOf(T(7)); });
+    double batch = millis([&]() { sink = sink + unrolled.indexOfAny(any, 3); });
+    std::printf("%-8s %12.2f %16.2f %16.2f %10.2f %12.2f\n", type, linked, scalar, vectorized, counted, batch);
+}
+
+int main()
+{
+    const int N = 10000000;
+    std::printf("kernels: %s, n=%d, times in ms\n", SimdSearch::isa(), N);
+    std::printf("%-8s %12s %16s %16s %10s %12s\n", "type", "linked", "unrolled scalar", "unrolled simd", "countOf", "indexOfAny");
+    run<int>("int", N);
+    run<float>("float", N);
+    run<double>("double", N);
+    run<char>("char", N);
+    return 0;
+}
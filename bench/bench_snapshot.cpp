@@ -0,0 +1,145 @@
+#include "src/CowList.h"
+#include "src/DoublyLinkedList.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -pthread -I. -Isrc bench/bench_snapshot.cpp src/CowList.cpp src/DoublyLinkedList.cpp src/SimdSearch.cpp -o bench_snapshot
+
+Writer throughput against snapshot frequency on a 10^6-element list. The
+writer does random set/insertAt/deleteAt and publishes a snapshot every K
+writes; with a reader thread, each published snapshot is picked up under a
+mutex and summed, so old versions stay alive while the writer copies paths.
+The last rows take the same snapshots the old way, by copying a
+DoublyLinkedList.
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::uint32_t nextRandom(std::uint32_t &seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static const int N = 1000000;
+static const int WRITES = 200000;
+
+// Returns writes per second
+static double runCow(int every, bool withReader, long long &reads)
+{
+    CowList<int> list;
+    for (int i = 0; i < N; ++i)
+        list.insertAtTail(i);
+
+    std::mutex latestLock;
+    CowList<int>::Snapshot latest = list.snapshot();
+    std::atomic<bool> done(false);
+    std::atomic<long long> readCount(0);
+    std::thread reader;
+    if (withReader)
+    {
+        reader = std::thread([&] {
+            long long sink = 0;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                CowList<int>::Snapshot view;
+                {
+                    std::lock_guard<std::mutex> guard(latestLock);
+                    view = latest;
+                }
+                for (int value : view)
+                    sink += value;
+                readCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (sink == 42)
+                std::printf(" ");
+        });
+    }
+
+    std::uint32_t seed = 2463534242u;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 1; i <= WRITES; ++i)
+    {
+        std::uint32_t r = nextRandom(seed);
+        int pos = int(r % std::uint32_t(list.size()));
+        switch (r >> 30)
+        {
+        case 0:
+            list.insertAt(pos, i);
+            break;
+        case 1:
+            list.deleteAt(pos);
+            break;
+        default:
+            list.set(pos, i);
+            break;
+        }
+        if (every && i % every == 0)
+        {
+            CowList<int>::Snapshot view = list.snapshot();
+            std::lock_guard<std::mutex> guard(latestLock);
+            latest = std::move(view);
+        }
+    }
+    double ms = msSince(t0);
+    done = true;
+    if (reader.joinable())
+        reader.join();
+    reads = readCount.load();
+    return WRITES / ms * 1000.0;
+}
+
+// Same workload, snapshotting by copying a DoublyLinkedList; only cheap end writes so the copy dominates
+static double runCopy(int every, int writes)
+{
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < N; ++i)
+        list.insertAtTail(i);
+    long long sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 1; i <= writes; ++i)
+    {
+        list.insertAtTail(i);
+        list.deleteAt(0);
+        if (i % every == 0)
+        {
+            DoublyLinkedList<int> view(list);
+            sink += view.size();
+        }
+    }
+    double ms = msSince(t0);
+    if (sink == 42)
+        std::printf(" ");
+    return writes / ms * 1000.0;
+}
+
+int main()
+{
+    const int intervals[] = {0, 10000, 1000, 100, 10, 1};
+    std::printf("%-10s %16s %16s %12s\n", "every K", "writes/s alone", "writes/s+reader", "reader scans");
+    for (int every : intervals)
+    {
+        long long reads = 0;
+        double alone = runCow(every, false, reads);
+        double shared = runCow(every, true, reads);
+        if (every)
+            std::printf("%-10d %16.0f %16.0f %12lld\n", every, alone, shared, reads);
+        else
+            std::printf("%-10s %16.0f %16.0f %12lld\n", "never", alone, shared, reads);
+    }
+    std::printf("DoublyLinkedList copy per snapshot:\n");
+    std::printf("%-10d %16.0f\n", 10000, runCopy(10000, 100000));
+    std::printf("%-10d %16.0f\n", 1000, runCopy(1000, 10000));
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "src/SortedDoublyLinkedList.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_sorted.cpp src/DoublyLinkedList.cpp -o bench_sorted
+
+Keeping a list of random ints sorted while inserting, then probing it with
+lookups, three ways: by hand (walk to find the position, then insertAt,
+which walks again), SortedDoublyLinkedList without the index (one walk per
+insert) and with the index (O(log n) search per insert and lookup).
+*/
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::vector<int> randomValues(int n)
+{
+    std::vector<int> values(n);
+    std::uint32_t seed = 88172645u;
+    for (int &v : values)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        v = int(seed % 1000000);
+    }
+    return values;
+}
+
+int main()
+{
+    std::printf("%-8s %16s %16s %16s %16s\n", "n", "by hand (ms)", "walk (ms)", "indexed (ms)", "lookups idx (ms)");
+    for (int n : {1000, 10000, 50000})
+    {
+        std::vector<int> values = randomValues(n);
+
+        auto t0 = std::chrono::steady_clock::now();
+        DoublyLinkedList<int> manual;
+        for (int v : values)
+        {
+            int pos = 0;
+            for (auto it = manual.begin(); it != manual.end() && *it < v; ++it)
+                ++pos;
+            manual.insertAt(pos, v);
+        }
+        double manualMs = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        SortedDoublyLinkedList<int> walked(std::less<int>(), false);
+        for (int v : values)
+            walked.insert(v);
+        double walkMs = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        SortedDoublyLinkedList<int> indexed;
+        for (int v : values)
+            indexed.insert(v);
+        double indexedMs = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        int hits = 0;
+        for (int v : values)
+            hits += indexed.contains(v + 1);
+        double lookupMs = msSince(t0);
+
+        if (manual.get(n / 2) != indexed.get(n / 2) || walked.get(n / 2) != indexed.get(n / 2))
+        {
+            std::printf("mismatch at n=%d\n", n);
+            return 1;
+        }
+        std::printf("%-8d %16.1f %16.1f %16.1f %16.2f  (%d hits)\n", n, manualMs, walkMs, indexedMs, lookupMs, hits);
+    }
+    return 0;
+}
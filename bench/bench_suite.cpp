@@ -0,0 +1,265 @@
+#include "src/DoublyLinkedList.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -pthread -I. -Isrc bench/bench_suite.cpp src/DoublyLinkedList.cpp -lbenchmark -o bench_suite
+
+Usage:
+    ./bench_suite --benchmark_out=results.json --benchmark_out_format=json
+    ./bench_suite --benchmark_filter='<int>/(10|100|1000)$'
+
+Google Benchmark suite for DoublyLinkedList: every public operation, all six
+instantiated types, sizes 10 to 10^7. The JSON written by --benchmark_out
+can be diffed between two builds with Google Benchmark's tools/compare.py.
+
+Each iteration is one operation on a list of (about) n elements. Insert and
+delete benchmarks restore the size in paused batches, so n drifts by at most
+a factor of two for tiny lists and by 256 elements otherwise. The list for
+one (type, n) is built once and shared by consecutive runs.
+*/
+
+template <typename T>
+struct Values;
+
+template <>
+struct Values<char>
+{
+    static char at(int i) { return char('a' + i % 26); }
+    static char missing() { return '#'; }
+};
+
+template <>
+struct Values<string>
+{
+    static string at(int i) { return "s" + std::to_string(i); }
+    static string missing() { return "missing"; }
+};
+
+template <>
+struct Values<int>
+{
+    static int at(int i) { return i; }
+    static int missing() { return -1; }
+};
+
+template <>
+struct Values<double>
+{
+    static double at(int i) { return i * 0.5; }
+    static double missing() { return -1.0; }
+};
+
+template <>
+struct Values<float>
+{
+    static float at(int i) { return float(i % 1000000) * 0.25f; }
+    static float missing() { return -1.0f; }
+};
+
+template <>
+struct Values<Point>
+{
+    static Point at(int i) { return Point(i, i + 1, i + 2); }
+    static Point missing() { return Point(-1, -1, -1); }
+};
+
+// Only one cached list is alive at a time, so the 10^7 lists of different types never coexist
+static void (*releaseCached)() = nullptr;
+
+template <typename T>
+static DoublyLinkedList<T> &cachedList()
+{
+    static DoublyLinkedList<T> list;
+    return list;
+}
+
+template <typename T>
+static void releaseList()
+{
+    DoublyLinkedList<T> empty;
+    empty.swap(cachedList<T>()); // swapping hands over the node pool too, so its memory goes with empty
+}
+
+template <typename T>
+static DoublyLinkedList<T> &fixture(int n)
+{
+    if (releaseCached != &releaseList<T>)
+    {
+        if (releaseCached)
+            releaseCached();
+        releaseCached = &releaseList<T>;
+    }
+    DoublyLinkedList<T> &list = cachedList<T>();
+    if (list.size() != n)
+    {
+        releaseList<T>();
+        for (int i = 0; i < n; ++i)
+            list.insertAtTail(Values<T>::at(i));
+    }
+    return list;
+}
+
+static std::uint32_t nextRandom(std::uint32_t &seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Runs op once per iteration and restore (untimed) after every batch of them
+template <typename Op, typename Restore>
+static void batched(benchmark::State &state, int batch, Op op, Restore restore)
+{
+    int pending = 0;
+    for (auto _ : state)
+    {
+        op();
+        if (++pending == batch)
+        {
+            state.PauseTiming();
+            restore(pending);
+            state.ResumeTiming();
+            pending = 0;
+        }
+    }
+    restore(pending);
+}
+
+template <typename T>
+static void BM_insertAtHead(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T value = Values<T>::at(7);
+    batched(state, std::min(256, list.size()), [&]() { list.insertAtHead(value); },
+            [&](int k) { while (k-- > 0) list.deleteAt(0); });
+}
+
+template <typename T>
+static void BM_insertAtTail(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T value = Values<T>::at(7);
+    batched(state, std::min(256, list.size()), [&]() { list.insertAtTail(value); },
+            [&](int k) { while (k-- > 0) list.deleteAt(list.size() - 1); });
+}
+
+template <typename T>
+static void BM_insertAtMiddle(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T value = Values<T>::at(7);
+    batched(state, std::min(256, list.size()), [&]() { list.insertAt(list.size() / 2, value); },
+            [&](int k) { while (k-- > 0) list.deleteAt(list.size() - 1); });
+}
+
+template <typename T>
+static void BM_insertAtRandom(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T value = Values<T>::at(7);
+    std::uint32_t seed = 2463534242u;
+    batched(state, std::min(256, list.size()), [&]() { list.insertAt(int(nextRandom(seed) % std::uint32_t(list.size() + 1)), value); },
+            [&](int k) { while (k-- > 0) list.deleteAt(list.size() - 1); });
+}
+
+template <typename T>
+static void BM_deleteAtMiddle(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T value = Values<T>::at(7);
+    batched(state, std::max(1, std::min(256, list.size() / 2)), [&]() { list.deleteAt(list.size() / 2); },
+            [&](int k) { while (k-- > 0) list.insertAtTail(value); });
+}
+
+template <typename T>
+static void BM_deleteAtRandom(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T value = Values<T>::at(7);
+    std::uint32_t seed = 2463534242u;
+    batched(state, std::max(1, std::min(256, list.size() / 2)), [&]() { list.deleteAt(int(nextRandom(seed) % std::uint32_t(list.size()))); },
+            [&](int k) { while (k-- > 0) list.insertAtTail(value); });
+}
+
+template <typename T>
+static void BM_get(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    std::uint32_t seed = 2463534242u;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(list.get(int(nextRandom(seed) % std::uint32_t(list.size()))));
+}
+
+template <typename T>
+static void BM_indexOf(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    const T missing = Values<T>::missing(); // a miss scans the whole list
+    for (auto _ : state)
+        benchmark::DoNotOptimize(list.indexOf(missing));
+    state.SetItemsProcessed(state.iterations() * list.size());
+}
+
+template <typename T>
+static void BM_reverse(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    for (auto _ : state)
+    {
+        list.reverse();
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename T>
+static void BM_toString(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    string out;
+    for (auto _ : state)
+    {
+        out.clear();
+        list.toString(out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * list.size());
+}
+
+template <typename T>
+static void BM_iterate(benchmark::State &state)
+{
+    DoublyLinkedList<T> &list = fixture<T>(int(state.range(0)));
+    for (auto _ : state)
+    {
+        for (T &value : list)
+            benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations() * list.size());
+}
+
+#define LIST_BENCHMARK_TYPE(fn, type) BENCHMARK_TEMPLATE(fn, type)->RangeMultiplier(10)->Range(10, 10000000)
+
+#define LIST_BENCHMARK(fn)               \
+    LIST_BENCHMARK_TYPE(fn, char);       \
+    LIST_BENCHMARK_TYPE(fn, string);     \
+    LIST_BENCHMARK_TYPE(fn, int);        \
+    LIST_BENCHMARK_TYPE(fn, double);     \
+    LIST_BENCHMARK_TYPE(fn, float);      \
+    LIST_BENCHMARK_TYPE(fn, Point)
+
+LIST_BENCHMARK(BM_insertAtHead);
+LIST_BENCHMARK(BM_insertAtTail);
+LIST_BENCHMARK(BM_insertAtMiddle);
+LIST_BENCHMARK(BM_insertAtRandom);
+LIST_BENCHMARK(BM_deleteAtMiddle);
+LIST_BENCHMARK(BM_deleteAtRandom);
+LIST_BENCHMARK(BM_get);
+LIST_BENCHMARK(BM_indexOf);
+LIST_BENCHMARK(BM_reverse);
+LIST_BENCHMARK(BM_toString);
+LIST_BENCHMARK(BM_iterate);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,73 @@
+#include "src/DoublyLinkedList.h"
+#include <chrono>
+#include <cstdio>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_tostring.cpp src/DoublyLinkedList.cpp -o bench_tostring
+
+Snapshots the same list repeatedly. "stream" is the ostringstream loop that
+toString() used before; "toString()" formats with to_chars into a fresh
+string; "toString(out)" reuses one buffer, so after the first call it does
+not allocate at all.
+*/
+
+template <typename T>
+static string streamed(const DoublyLinkedList<T> &list)
+{
+    std::ostringstream oss;
+    oss << "[";
+    bool first = true;
+    for (const T &value : list)
+    {
+        if (!first)
+            oss << ", ";
+        first = false;
+        oss << value;
+    }
+    oss << "]";
+    return oss.str();
+}
+
+template <typename T, typename Make>
+static void run(const char *name, Make make)
+{
+    const int N = 1000;
+    const int ROUNDS = 2000;
+    DoublyLinkedList<T> list;
+    for (int i = 0; i < N; ++i)
+        list.insertAtTail(make(i));
+
+    std::size_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        sink += streamed(list).size();
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        sink += list.toString().size();
+    auto t2 = std::chrono::steady_clock::now();
+    string out;
+    for (int r = 0; r < ROUNDS; ++r)
+    {
+        out.clear();
+        list.toString(out);
+        sink += out.size();
+    }
+    auto t3 = std::chrono::steady_clock::now();
+
+    auto perElem = [&](std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double, std::nano>(d).count() / (double(N) * ROUNDS);
+    };
+    std::printf("%-8s %14.2f %14.2f %14.2f   (%zu)\n", name, perElem(t1 - t0), perElem(t2 - t1), perElem(t3 - t2), sink % 10);
+}
+
+int main()
+{
+    std::printf("%-8s %14s %14s %14s   ns/element\n", "type", "stream", "toString()", "toString(out)");
+    run<int>("int", [](int i) { return i * 7919; });
+    run<double>("double", [](int i) { return i / 3.0; });
+    run<float>("float", [](int i) { return float(i) * 0.37f; });
+    run<Point>("Point", [](int i) { return Point(i, i / 2.0, -i / 3.0); });
+    run<string>("string", [](int i) { return "item" + std::to_string(i); });
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include "src/DoublyLinkedList.h"
+#include "src/UnrolledLinkedList.h"
+#include <chrono>
+#include <cstdio>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_unrolled.cpp src/DoublyLinkedList.cpp src/UnrolledLinkedList.cpp src/SimdSearch.cpp -o bench_unrolled
+
+Scans over 10^7 ints: one node per element versus CAPACITY elements per node.
+*/
+
+template <typename F>
+static double millis(F f)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+template <typename List>
+static void run(const char *name, int n)
+{
+    List list;
+    double build = millis([&]() {
+        for (int i = 0; i < n; ++i)
+            list.insertAtTail(i);
+    });
+    long sum = 0;
+    double iterate = millis([&]() {
+        for (int x : list)
+            sum += x;
+    });
+    int found = 0;
+    double search = millis([&]() { found = list.indexOf(-1); });
+    size_t chars = 0;
+    double format = millis([&]() { chars = list.toString().size(); });
+    std::printf("%-20s %10.1f %10.1f %10.1f %10.1f   (sum=%ld found=%d chars=%zu)\n",
+                name, build, iterate, search, format, sum, found, chars);
+}
+
+int main()
+{
+    const int N = 10000000;
+    std::printf("%-20s %10s %10s %10s %10s  [ms, n=%d]\n", "layout", "build", "iterate", "indexOf", "toString", N);
+    run<DoublyLinkedList<int>>("DoublyLinkedList", N);
+    run<UnrolledLinkedList<int>>("UnrolledLinkedList", N);
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "src/DoublyLinkedList.h"
+#include "src/VersionedList.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sys/resource.h>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -I. -Isrc bench/bench_versioned.cpp src/VersionedList.cpp src/CowList.cpp src/DoublyLinkedList.cpp src/SimdSearch.cpp -o bench_versioned
+
+Run once per mode (peak memory is per process):
+    ! ./bench_versioned copies
+    ! ./bench_versioned versioned
+
+Editor-style history for a 20000-character document: random single
+character inserts and deletes, keeping every version. "copies" keeps a full
+DoublyLinkedList<char> copy per version; "versioned" keeps a VersionedList
+whose versions share unchanged chunks. Prints time and the peak resident
+set size, then reads back an old version to check it is still intact.
+*/
+
+static const int N = 20000;
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static long peakKb()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Position and kind of the i-th edit; the same sequence in both modes
+static int nextEdit(std::uint32_t &seed, int size, bool &insert)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    insert = (seed & 1) || size == 0;
+    return int((seed >> 1) % std::uint32_t(insert ? size + 1 : size));
+}
+
+static void runCopies(int edits)
+{
+    std::vector<DoublyLinkedList<char>> history(1);
+    for (int i = 0; i < N; ++i)
+        history[0].insertAtTail(char('a' + i % 26));
+    std::uint32_t seed = 2463534242u;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < edits; ++i)
+    {
+        history.push_back(history.back());
+        DoublyLinkedList<char> &doc = history.back();
+        bool insert;
+        int pos = nextEdit(seed, doc.size(), insert);
+        if (insert)
+            doc.insertAt(pos, '*');
+        else
+            doc.deleteAt(pos);
+    }
+    double ms = msSince(t0);
+    std::printf("copies:    %6d edits %9.1f ms  peak %8ld KB  v1 starts %c\n", edits, ms, peakKb(),
+                history[1].get(0));
+}
+
+static void runVersioned(int edits)
+{
+    VersionedList<char> doc;
+    for (int i = 0; i < N; ++i)
+        doc.insertAtTail(char('a' + i % 26));
+    int base = doc.currentVersion();
+    std::uint32_t seed = 2463534242u;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < edits; ++i)
+    {
+        bool insert;
+        int pos = nextEdit(seed, doc.size(), insert);
+        if (insert)
+            doc.insertAt(pos, '*');
+        else
+            doc.deleteAt(pos);
+    }
+    double ms = msSince(t0);
+    std::printf("versioned: %6d edits %9.1f ms  peak %8ld KB  v1 starts %c\n", edits, ms, peakKb(),
+                doc.version(base + 1).get(0));
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && std::strcmp(argv[1], "copies") == 0)
+        runCopies(2000);
+    else
+    {
+        runVersioned(2000);
+        runVersioned(100000);
+    }
+    return 0;
+}
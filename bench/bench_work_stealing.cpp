@@ -0,0 +1,126 @@
+#include "src/ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/*
+Build:
+    ! g++ -std=c++17 -O2 -pthread -I. -Isrc bench/bench_work_stealing.cpp src/ThreadPool.cpp -o bench_work_stealing
+
+Usage: ./bench_work_stealing [threads]
+
+Walks an irregular task tree: every node burns a random amount of CPU and
+has a random number of children, so subtrees differ in size by orders of
+magnitude. "static" hands each thread an equal share of the root's
+children up front; "stealing" submits every node as a task to ThreadPool
+and lets idle workers steal. The tree is the same in every run.
+*/
+
+static std::uint64_t mix(std::uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    return x ^ (x >> 33);
+}
+
+static int childCount(std::uint64_t id, int depth)
+{
+    if (depth >= 9)
+        return 0;
+    std::uint64_t r = mix(id) % 100;
+    return r < 35 ? 0 : r < 60 ? 2 : r < 85 ? 3 : 5;
+}
+
+static double work(std::uint64_t id)
+{
+    // Mostly small nodes with a heavy tail
+    int spins = 200 + int(mix(id ^ 0x5bd1e995) % 100 < 5 ? 20000 : mix(id) % 2000);
+    double acc = 0;
+    for (int i = 0; i < spins; ++i)
+        acc += double(i ^ int(id)) * 1e-9;
+    return acc;
+}
+
+static std::atomic<long> nodesVisited(0);
+
+static void visitSerial(std::uint64_t id, int depth, double &sink)
+{
+    sink += work(id);
+    nodesVisited.fetch_add(1, std::memory_order_relaxed);
+    int n = childCount(id, depth);
+    for (int c = 0; c < n; ++c)
+        visitSerial(mix(id + c + 1), depth + 1, sink);
+}
+
+static void visitPool(ThreadPool &pool, std::uint64_t id, int depth, std::atomic<long> &sink)
+{
+    sink.fetch_add(long(work(id) * 1e6), std::memory_order_relaxed);
+    nodesVisited.fetch_add(1, std::memory_order_relaxed);
+    int n = childCount(id, depth);
+    for (int c = 0; c < n; ++c)
+    {
+        std::uint64_t child = mix(id + c + 1);
+        pool.submit([&pool, child, depth, &sink] { visitPool(pool, child, depth + 1, sink); });
+    }
+}
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int threads = argc > 1 ? std::atoi(argv[1]) : int(std::thread::hardware_concurrency());
+    if (threads < 1)
+        threads = 1;
+    const std::uint64_t ROOT = 42;
+    // Give the root plenty of children so static partitioning has something to split
+    std::vector<std::uint64_t> roots;
+    for (int i = 0; i < 64; ++i)
+        roots.push_back(mix(ROOT + i));
+
+    auto t0 = std::chrono::steady_clock::now();
+    double serialSink = 0;
+    for (std::uint64_t r : roots)
+        visitSerial(r, 0, serialSink);
+    double serialMs = msSince(t0);
+    long nodes = nodesVisited.exchange(0);
+
+    t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> fixed;
+    std::vector<double> sinks(threads, 0);
+    for (int t = 0; t < threads; ++t)
+    {
+        fixed.emplace_back([&, t] {
+            for (std::size_t i = t; i < roots.size(); i += threads)
+                visitSerial(roots[i], 0, sinks[t]);
+        });
+    }
+    for (std::thread &f : fixed)
+        f.join();
+    double staticMs = msSince(t0);
+    nodesVisited = 0;
+
+    std::atomic<long> poolSink(0);
+    ThreadPool pool(threads);
+    t0 = std::chrono::steady_clock::now();
+    for (std::uint64_t r : roots)
+        pool.submit([&pool, r, &poolSink] { visitPool(pool, r, 0, poolSink); });
+    pool.wait();
+    double stealingMs = msSince(t0);
+
+    if (nodesVisited != nodes)
+        return 1;
+    std::printf("%ld nodes, %d threads\n", nodes, threads);
+    std::printf("  serial   %9.1f ms\n", serialMs);
+    std::printf("  static   %9.1f ms  (speedup %.2fx)\n", staticMs, serialMs / staticMs);
+    std::printf("  stealing %9.1f ms  (speedup %.2fx, %ld steals)\n", stealingMs, serialMs / stealingMs, pool.steals());
+    return 0;
+}
@@ -0,0 +1,259 @@
+#ifndef __BINARY_FORMAT_H__
+#define __BINARY_FORMAT_H__
+
+#include "main.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BINARY_FORMAT_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @class BinaryFormat
+ * @brief Compact on-disk layout for list snapshots
+ *
+ * A file is a 16-byte header (magic "DLL1", a uint32 element type tag and a
+ * uint64 element count) followed by the elements packed back to back:
+ * char, int, float and double as their raw bytes, Point as three doubles
+ * and string as a uint32 byte count followed by the bytes. Values are stored
+ * in native byte order, so files move between machines of the same
+ * endianness only.
+ */
+class BinaryFormat
+{
+public:
+    static const std::uint32_t TAG_CHAR = 1;
+    static const std::uint32_t TAG_INT = 2;
+    static const std::uint32_t TAG_FLOAT = 3;
+    static const std::uint32_t TAG_DOUBLE = 4;
+    static const std::uint32_t TAG_STRING = 5;
+    static const std::uint32_t TAG_POINT = 6;
+    static const std::size_t HEADER_SIZE = 16;
+
+    template <typename T>
+    static std::uint32_t tagOf();
+
+    /**
+     * @class Writer
+     * @brief Buffers encoded elements and hands them to a stream in large blocks
+     */
+    class Writer
+    {
+    private:
+        static const std::size_t BLOCK = 1 << 16;
+        std::ostream &out;
+        string buffer;
+
+        void put(const void *bytes, std::size_t n)
+        {
+            buffer.append(static_cast<const char *>(bytes), n);
+            if (buffer.size() >= BLOCK)
+                flush();
+        }
+
+    public:
+        explicit Writer(std::ostream &out) : out(out)
+        {
+            buffer.reserve(BLOCK + 64);
+        }
+
+        ~Writer()
+        {
+            flush();
+        }
+
+        void header(std::uint32_t tag, std::uint64_t length)
+        {
+            put("DLL1", 4);
+            put(&tag, sizeof(tag));
+            put(&length, sizeof(length));
+        }
+
+        void write(char value) { put(&value, sizeof(value)); }
+        void write(int value) { put(&value, sizeof(value)); }
+        void write(float value) { put(&value, sizeof(value)); }
+        void write(double value) { put(&value, sizeof(value)); }
+
+        void write(const string &value)
+        {
+            std::uint32_t size = std::uint32_t(value.size());
+            put(&size, sizeof(size));
+            put(value.data(), value.size());
+        }
+
+        void write(const Point &value)
+        {
+            double xyz[3] = {value.getX(), value.getY(), value.getZ()};
+            put(xyz, sizeof(xyz));
+        }
+
+        void flush()
+        {
+            out.write(buffer.data(), std::streamsize(buffer.size()));
+            buffer.clear();
+        }
+    };
+
+    /**
+     * @class Reader
+     * @brief Decodes elements from a byte range; throws std::runtime_error on truncation
+     */
+    class Reader
+    {
+    private:
+        const char *pos;
+        const char *end;
+
+        void take(void *bytes, std::size_t n)
+        {
+            if (std::size_t(end - pos) < n)
+                throw std::runtime_error("binary list data is truncated");
+            std::memcpy(bytes, pos, n);
+            pos += n;
+        }
+
+    public:
+        Reader(const char *data, std::size_t size) : pos(data), end(data + size) {}
+
+        // Checks magic and type tag, and returns the element count
+        std::uint64_t header(std::uint32_t expectedTag)
+        {
+            char magic[4];
+            std::uint32_t tag;
+            std::uint64_t length;
+            take(magic, sizeof(magic));
+            take(&tag, sizeof(tag));
+            take(&length, sizeof(length));
+            if (std::memcmp(magic, "DLL1", 4) != 0)
+                throw std::runtime_error("not a binary list file");
+            if (tag != expectedTag)
+                throw std::runtime_error("binary list holds a different element type");
+            return length;
+        }
+
+        void read(char &value) { take(&value, sizeof(value)); }
+        void read(int &value) { take(&value, sizeof(value)); }
+        void read(float &value) { take(&value, sizeof(value)); }
+        void read(double &value) { take(&value, sizeof(value)); }
+
+        void read(string &value)
+        {
+            std::uint32_t size;
+            take(&size, sizeof(size));
+            if (std::size_t(end - pos) < size)
+                throw std::runtime_error("binary list data is truncated");
+            value.assign(pos, size);
+            pos += size;
+        }
+
+        void read(Point &value)
+        {
+            double xyz[3];
+            take(xyz, sizeof(xyz));
+            value = Point(xyz[0], xyz[1], xyz[2]);
+        }
+
+        std::size_t remaining() const
+        {
+            return std::size_t(end - pos);
+        }
+    };
+
+    /**
+     * @class MappedFile
+     * @brief Read-only view of a whole file, memory-mapped where the OS allows
+     */
+    class MappedFile
+    {
+    private:
+        const char *bytes = nullptr;
+        std::size_t length = 0;
+        string fallback; // file contents when mmap is unavailable
+
+    public:
+        explicit MappedFile(const string &path);
+        ~MappedFile();
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        const char *data() const { return bytes; }
+        std::size_t size() const { return length; }
+    };
+};
+
+template <>
+inline std::uint32_t BinaryFormat::tagOf<char>() { return TAG_CHAR; }
+template <>
+inline std::uint32_t BinaryFormat::tagOf<int>() { return TAG_INT; }
+template <>
+inline std::uint32_t BinaryFormat::tagOf<float>() { return TAG_FLOAT; }
+template <>
+inline std::uint32_t BinaryFormat::tagOf<double>() { return TAG_DOUBLE; }
+template <>
+inline std::uint32_t BinaryFormat::tagOf<string>() { return TAG_STRING; }
+template <>
+inline std::uint32_t BinaryFormat::tagOf<Point>() { return TAG_POINT; }
+
+#ifdef BINARY_FORMAT_MMAP
+
+inline BinaryFormat::MappedFile::MappedFile(const string &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + path);
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("cannot stat " + path);
+    }
+    length = std::size_t(info.st_size);
+    if (length > 0)
+    {
+        void *mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::runtime_error("cannot map " + path);
+        }
+        // The loader reads front to back exactly once
+        ::madvise(mapped, length, MADV_SEQUENTIAL);
+        bytes = static_cast<const char *>(mapped);
+    }
+    ::close(fd); // the mapping stays valid without the descriptor
+}
+
+inline BinaryFormat::MappedFile::~MappedFile()
+{
+    if (bytes)
+        ::munmap(const_cast<char *>(bytes), length);
+}
+
+#else // no mmap: read the whole file into memory instead
+
+inline BinaryFormat::MappedFile::MappedFile(const string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("cannot open " + path);
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    fallback = contents.str();
+    bytes = fallback.data();
+    length = fallback.size();
+}
+
+inline BinaryFormat::MappedFile::~MappedFile()
+{
+}
+
+#endif // BINARY_FORMAT_MMAP
+
+#endif // __BINARY_FORMAT_H__
@@ -0,0 +1,200 @@
+#include "ConcurrentDoublyLinkedList.h"
+#include <thread>
+
+template <typename T>
+ConcurrentDoublyLinkedList<T>::ConcurrentDoublyLinkedList() : length(0)
+{
+    head.next = &tail;
+    tail.prev = &head;
+}
+
+template <typename T>
+ConcurrentDoublyLinkedList<T>::~ConcurrentDoublyLinkedList()
+{
+    // No other thread may use the list any more, so no locking
+    Node *curr = head.next;
+    while (curr != &tail)
+    {
+        Node *next = curr->next;
+        delete curr;
+        curr = next;
+    }
+}
+
+template <typename T>
+typename ConcurrentDoublyLinkedList<T>::Node *ConcurrentDoublyLinkedList<T>::lockBefore(int index)
+{
+    head.lock.lock();
+    Node *pred = &head;
+    for (int i = 0; i < index; ++i)
+    {
+        Node *curr = pred->next;
+        if (curr == &tail)
+        {
+            pred->lock.unlock();
+            return nullptr;
+        }
+        curr->lock.lock();
+        pred->lock.unlock();
+        pred = curr;
+    }
+    return pred;
+}
+
+template <typename T>
+void ConcurrentDoublyLinkedList<T>::insertAtHead(const T &data)
+{
+    Node *newNode = new Node(data);
+    std::lock_guard<std::mutex> predLock(head.lock);
+    Node *succ = head.next;
+    std::lock_guard<std::mutex> succLock(succ->lock);
+    newNode->prev = &head;
+    newNode->next = succ;
+    succ->prev = newNode;
+    head.next = newNode;
+    length.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+void ConcurrentDoublyLinkedList<T>::insertAtTail(const T &data)
+{
+    Node *newNode = new Node(data);
+    while (true)
+    {
+        // While tail is locked, tail.prev can neither be unlinked nor change
+        std::unique_lock<std::mutex> tailLock(tail.lock);
+        Node *pred = tail.prev;
+        std::unique_lock<std::mutex> predLock(pred->lock, std::try_to_lock);
+        if (!predLock.owns_lock())
+        {
+            // Someone walking forward holds pred and may be waiting for tail
+            tailLock.unlock();
+            std::this_thread::yield();
+            continue;
+        }
+        newNode->prev = pred;
+        newNode->next = &tail;
+        pred->next = newNode;
+        tail.prev = newNode;
+        length.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+}
+
+template <typename T>
+void ConcurrentDoublyLinkedList<T>::insertAt(int index, const T &data)
+{
+    if (index < 0)
+        throw std::out_of_range("insertAt index out of range");
+    Node *pred = lockBefore(index);
+    if (!pred)
+        throw std::out_of_range("insertAt index out of range");
+    std::lock_guard<std::mutex> predLock(pred->lock, std::adopt_lock);
+    Node *succ = pred->next;
+    std::lock_guard<std::mutex> succLock(succ->lock);
+    Node *newNode = new Node(data);
+    newNode->prev = pred;
+    newNode->next = succ;
+    succ->prev = newNode;
+    pred->next = newNode;
+    length.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+void ConcurrentDoublyLinkedList<T>::deleteAt(int index)
+{
+    if (index < 0)
+        throw std::out_of_range("deleteAt index out of range");
+    Node *pred = lockBefore(index);
+    if (!pred)
+        throw std::out_of_range("deleteAt index out of range");
+    std::unique_lock<std::mutex> predLock(pred->lock, std::adopt_lock);
+    Node *curr = pred->next;
+    if (curr == &tail)
+        throw std::out_of_range("deleteAt index out of range");
+    std::unique_lock<std::mutex> currLock(curr->lock);
+    Node *succ = curr->next;
+    std::lock_guard<std::mutex> succLock(succ->lock);
+    pred->next = succ;
+    succ->prev = pred;
+    length.fetch_sub(1, std::memory_order_relaxed);
+    // Nobody else can reach curr now: getting to it needs pred's lock
+    currLock.unlock();
+    delete curr;
+}
+
+template <typename T>
+T ConcurrentDoublyLinkedList<T>::get(int index)
+{
+    if (index < 0)
+        throw std::out_of_range("get index out of range");
+    Node *pred = lockBefore(index + 1);
+    if (!pred)
+        throw std::out_of_range("get index out of range");
+    std::lock_guard<std::mutex> nodeLock(pred->lock, std::adopt_lock);
+    return pred->data;
+}
+
+template <typename T>
+bool ConcurrentDoublyLinkedList<T>::contains(const T &item)
+{
+    bool found = false;
+    forEach([&](T &value) {
+        if (!found && value == item)
+            found = true;
+    });
+    return found;
+}
+
+template <typename T>
+int ConcurrentDoublyLinkedList<T>::size() const
+{
+    return length.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void ConcurrentDoublyLinkedList<T>::clear()
+{
+    // Pop from the front while holding head, so no walker can follow us in
+    // and threads further down keep working on a consistent chain. The
+    // count bound keeps concurrent insertAtTail calls from starving us.
+    std::lock_guard<std::mutex> headLock(head.lock);
+    for (int n = length.load(std::memory_order_relaxed); n > 0; --n)
+    {
+        Node *curr = head.next;
+        if (curr == &tail)
+            return;
+        std::unique_lock<std::mutex> currLock(curr->lock);
+        Node *succ = curr->next;
+        std::lock_guard<std::mutex> succLock(succ->lock);
+        head.next = succ;
+        succ->prev = &head;
+        length.fetch_sub(1, std::memory_order_relaxed);
+        currLock.unlock();
+        delete curr;
+    }
+}
+
+template <typename T>
+string ConcurrentDoublyLinkedList<T>::toString()
+{
+    std::ostringstream oss;
+    oss << "[";
+    bool first = true;
+    forEach([&](T &value) {
+        if (!first)
+            oss << ", ";
+        first = false;
+        oss << value;
+    });
+    oss << "]";
+    return oss.str();
+}
+
+// Explicit template instantiation for char, string, int, double, float, and Point
+template class ConcurrentDoublyLinkedList<char>;
+template class ConcurrentDoublyLinkedList<string>;
+template class ConcurrentDoublyLinkedList<int>;
+template class ConcurrentDoublyLinkedList<double>;
+template class ConcurrentDoublyLinkedList<float>;
+template class ConcurrentDoublyLinkedList<Point>;
@@ -0,0 +1,85 @@
+#ifndef __CONCURRENT_DOUBLY_LINKED_LIST_H__
+#define __CONCURRENT_DOUBLY_LINKED_LIST_H__
+
+#include "main.h"
+#include <atomic>
+#include <mutex>
+
+/**
+ * @class ConcurrentDoublyLinkedList
+ * @brief Doubly linked list that many threads can modify and walk at once
+ *
+ * Every node (and both sentinels) carries its own mutex. Walks lock
+ * hand-over-hand from the head, so threads working on different parts of
+ * the list do not block each other. Locks are always taken head to tail;
+ * the one exception, insertAtTail, locks the tail sentinel first and only
+ * try_locks its predecessor, backing off on failure, so it cannot deadlock.
+ * Unlinking a node requires the locks of its predecessor, itself and its
+ * successor, and a walker can only reach a node while holding its
+ * predecessor, so a node is never freed under another thread.
+ *
+ * Indices are positions at the moment the walk reaches them; size() is an
+ * atomic counter and may be stale by the time the caller uses it.
+ */
+template <typename T>
+class ConcurrentDoublyLinkedList
+{
+private:
+    struct Node
+    {
+        T data;
+        Node *prev;
+        Node *next;
+        std::mutex lock;
+
+        Node() : prev(nullptr), next(nullptr) {}
+        Node(const T &val) : data(val), prev(nullptr), next(nullptr) {}
+    };
+
+    Node head; // Dummy head
+    Node tail; // Dummy tail
+    std::atomic<int> length;
+
+    // Lock head..node at logical position index - 1 and return it locked (index may equal length)
+    Node *lockBefore(int index);
+
+public:
+    ConcurrentDoublyLinkedList();
+    ~ConcurrentDoublyLinkedList();
+    ConcurrentDoublyLinkedList(const ConcurrentDoublyLinkedList &) = delete;
+    ConcurrentDoublyLinkedList &operator=(const ConcurrentDoublyLinkedList &) = delete;
+
+    void insertAtHead(const T &data);
+    void insertAtTail(const T &data);
+    void insertAt(int index, const T &data);
+    void deleteAt(int index);
+    // Copy of the element; a reference could dangle once the lock is released
+    T get(int index);
+    bool contains(const T &item);
+    int size() const;
+    // Remove size() elements from the front; elements added meanwhile may remain
+    void clear();
+    string toString();
+
+    /**
+     * Call fn(element) for each element, head to tail, while holding that
+     * element's lock. fn may modify the element but must not call back into
+     * this list.
+     */
+    template <typename Fn>
+    void forEach(Fn fn)
+    {
+        std::unique_lock<std::mutex> held(head.lock);
+        Node *curr = head.next;
+        while (curr != &tail)
+        {
+            std::unique_lock<std::mutex> next(curr->lock);
+            held.swap(next);
+            next.unlock();
+            fn(curr->data);
+            curr = curr->next;
+        }
+    }
+};
+
+#endif // __CONCURRENT_DOUBLY_LINKED_LIST_H__
@@ -0,0 +1,343 @@
+#include "CowList.h"
+#include "SimdSearch.h"
+#include "ValueFormat.h"
+#include <atomic>
+
+template <typename T>
+typename CowList<T>::Node *CowList<T>::own(std::shared_ptr<Node> &slot)
+{
+    if (slot.use_count() != 1)
+    {
+        // Shared with a snapshot (or another list): this write gets its own copy
+        slot = std::make_shared<Node>(*slot);
+    }
+    else
+    {
+        // Sole owner now, but a reader may only just have dropped its copy;
+        // pairs with the release in its reference count decrement
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return slot.get();
+}
+
+template <typename T>
+int CowList<T>::childFor(const Node *node, int &index, bool inserting)
+{
+    int last = int(node->children.size()) - 1;
+    for (int i = 0; i < last; ++i)
+    {
+        int size = node->children[i]->size;
+        if (index < size || (inserting && index == size))
+            return i;
+        index -= size;
+    }
+    return last;
+}
+
+template <typename T>
+std::shared_ptr<typename CowList<T>::Node> CowList<T>::insertInto(std::shared_ptr<Node> &slot, int index,
+                                                                  const T &data)
+{
+    Node *node = own(slot);
+    ++node->size;
+    std::shared_ptr<Node> right;
+    if (node->isLeaf())
+    {
+        node->items.insert(node->items.begin() + index, data);
+        int count = int(node->items.size());
+        if (count <= LEAF_CAPACITY)
+            return right;
+        // Appends keep the left chunk full and prepends the right one, so
+        // building a list from either end leaves dense chunks
+        int keep = index == count - 1 ? LEAF_CAPACITY : index == 0 ? 1 : count / 2;
+        right = std::make_shared<Node>();
+        right->items.assign(node->items.begin() + keep, node->items.end());
+        right->size = count - keep;
+        node->items.resize(keep);
+        node->size = keep;
+        return right;
+    }
+
+    int i = childFor(node, index, true);
+    std::shared_ptr<Node> sibling = insertInto(node->children[i], index, data);
+    if (!sibling)
+        return right;
+    node->children.insert(node->children.begin() + i + 1, sibling);
+    int count = int(node->children.size());
+    if (count <= BRANCH)
+        return right;
+    // Inner nodes always split evenly so that each keeps at least BRANCH / 2 children
+    int keep = count / 2;
+    right = std::make_shared<Node>();
+    right->children.assign(node->children.begin() + keep, node->children.end());
+    for (const auto &child : right->children)
+        right->size += child->size;
+    node->children.resize(keep);
+    node->size -= right->size;
+    return right;
+}
+
+template <typename T>
+void CowList<T>::eraseFrom(std::shared_ptr<Node> &slot, int index)
+{
+    Node *node = own(slot);
+    --node->size;
+    if (node->isLeaf())
+    {
+        node->items.erase(node->items.begin() + index);
+        return;
+    }
+    int i = childFor(node, index, false);
+    eraseFrom(node->children[i], index);
+    const Node *child = node->children[i].get();
+    if (child->isLeaf() ? int(child->items.size()) < LEAF_CAPACITY / 2 : int(child->children.size()) < BRANCH / 2)
+        fixChild(node, i);
+}
+
+template <typename T>
+void CowList<T>::fixChild(Node *parent, int i)
+{
+    if (parent->children.size() < 2)
+        return;
+    int left = i > 0 ? i - 1 : i;
+    Node *a = own(parent->children[left]);
+    Node *b = own(parent->children[left + 1]);
+    if (a->isLeaf())
+    {
+        int total = int(a->items.size() + b->items.size());
+        if (total <= LEAF_CAPACITY)
+        {
+            a->items.insert(a->items.end(), b->items.begin(), b->items.end());
+            a->size = total;
+            parent->children.erase(parent->children.begin() + left + 1);
+            return;
+        }
+        // Too many for one chunk: split them evenly instead
+        std::vector<T> all(a->items);
+        all.insert(all.end(), b->items.begin(), b->items.end());
+        int keep = total / 2;
+        a->items.assign(all.begin(), all.begin() + keep);
+        b->items.assign(all.begin() + keep, all.end());
+        a->size = keep;
+        b->size = total - keep;
+        return;
+    }
+
+    int total = int(a->children.size() + b->children.size());
+    int elements = a->size + b->size;
+    if (total <= BRANCH)
+    {
+        a->children.insert(a->children.end(), b->children.begin(), b->children.end());
+        a->size = elements;
+        parent->children.erase(parent->children.begin() + left + 1);
+        return;
+    }
+    std::vector<std::shared_ptr<Node>> all(a->children);
+    all.insert(all.end(), b->children.begin(), b->children.end());
+    int keep = total / 2;
+    a->children.assign(all.begin(), all.begin() + keep);
+    b->children.assign(all.begin() + keep, all.end());
+    a->size = 0;
+    for (const auto &child : a->children)
+        a->size += child->size;
+    b->size = elements - a->size;
+}
+
+template <typename T>
+template <typename Fn>
+bool CowList<T>::forEachLeaf(const Node *node, Fn &fn)
+{
+    if (node->isLeaf())
+        return fn(node->items.data(), int(node->items.size()));
+    for (const auto &child : node->children)
+    {
+        if (!forEachLeaf(child.get(), fn))
+            return false;
+    }
+    return true;
+}
+
+template <typename T>
+int CowList<T>::size() const
+{
+    return root ? root->size : 0;
+}
+
+template <typename T>
+bool CowList<T>::empty() const
+{
+    return !root;
+}
+
+template <typename T>
+const T &CowList<T>::get(int index) const
+{
+    if (index < 0 || index >= size())
+        throw std::out_of_range("get index out of range");
+    const Node *node = root.get();
+    while (!node->isLeaf())
+        node = node->children[childFor(node, index, false)].get();
+    return node->items[index];
+}
+
+template <typename T>
+void CowList<T>::set(int index, const T &data)
+{
+    if (index < 0 || index >= size())
+        throw std::out_of_range("set index out of range");
+    // Path copy: every shared node from the root to the leaf is copied once
+    std::shared_ptr<Node> *slot = &root;
+    Node *node = own(*slot);
+    while (!node->isLeaf())
+    {
+        slot = &node->children[childFor(node, index, false)];
+        node = own(*slot);
+    }
+    node->items[index] = data;
+}
+
+template <typename T>
+void CowList<T>::insertAtHead(const T &data)
+{
+    insertAt(0, data);
+}
+
+template <typename T>
+void CowList<T>::insertAtTail(const T &data)
+{
+    insertAt(size(), data);
+}
+
+template <typename T>
+void CowList<T>::insertAt(int index, const T &data)
+{
+    if (index < 0 || index > size())
+        throw std::out_of_range("insertAt index out of range");
+    if (!root)
+    {
+        root = std::make_shared<Node>();
+        root->items.reserve(LEAF_CAPACITY + 1);
+        root->items.push_back(data);
+        root->size = 1;
+        return;
+    }
+    std::shared_ptr<Node> sibling = insertInto(root, index, data);
+    if (sibling)
+    {
+        // The root split: the tree grows one level
+        auto grown = std::make_shared<Node>();
+        grown->size = root->size + sibling->size;
+        grown->children.push_back(std::move(root));
+        grown->children.push_back(std::move(sibling));
+        root = std::move(grown);
+    }
+}
+
+template <typename T>
+void CowList<T>::deleteAt(int index)
+{
+    if (index < 0 || index >= size())
+        throw std::out_of_range("deleteAt index out of range");
+    eraseFrom(root, index);
+    // Merges below may leave a root with a single child, or an empty chunk
+    while (!root->isLeaf() && root->children.size() == 1)
+    {
+        std::shared_ptr<Node> only = root->children[0];
+        root = std::move(only);
+    }
+    if (root->isLeaf() && root->items.empty())
+        root.reset();
+}
+
+template <typename T>
+int CowList<T>::indexOf(const T &item) const
+{
+    if (!root)
+        return -1;
+    int offset = 0;
+    int found = -1;
+    auto search = [&](const T *items, int count) {
+        int at = SimdSearch::findFirst(items, count, item);
+        if (at >= 0)
+        {
+            found = offset + at;
+            return false;
+        }
+        offset += count;
+        return true;
+    };
+    forEachLeaf(root.get(), search);
+    return found;
+}
+
+template <typename T>
+bool CowList<T>::contains(const T &item) const
+{
+    return indexOf(item) != -1;
+}
+
+template <typename T>
+void CowList<T>::clear()
+{
+    // Nodes still held by snapshots stay alive for them
+    root.reset();
+}
+
+template <typename T>
+string CowList<T>::toString(string (*convert2str)(T &) /*= 0*/) const
+{
+    string out;
+    if (!convert2str)
+    {
+        toString(out);
+        return out;
+    }
+    out += "[";
+    bool first = true;
+    for (const T &value : *this)
+    {
+        if (!first)
+            out += ", ";
+        first = false;
+        out += convert2str(const_cast<T &>(value));
+    }
+    out += "]";
+    return out;
+}
+
+template <typename T>
+void CowList<T>::toString(string &out) const
+{
+    out.reserve(out.size() + 2 + std::size_t(size()) * (ValueFormat::estimatedWidth<T>() + 2));
+    out += '[';
+    if (root)
+    {
+        bool first = true;
+        auto append = [&](const T *items, int count) {
+            for (int i = 0; i < count; ++i)
+            {
+                if (!first)
+                    out += ", ";
+                first = false;
+                ValueFormat::append(out, items[i]);
+            }
+            return true;
+        };
+        forEachLeaf(root.get(), append);
+    }
+    out += ']';
+}
+
+template <typename T>
+typename CowList<T>::Snapshot CowList<T>::snapshot() const
+{
+    return Snapshot(*this);
+}
+
+// Explicit template instantiation for char, string, int, double, float, and Point
+template class CowList<char>;
+template class CowList<string>;
+template class CowList<int>;
+template class CowList<double>;
+template class CowList<float>;
+template class CowList<Point>;
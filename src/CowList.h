@@ -0,0 +1,298 @@
+#ifndef __COW_LIST_H__
+#define __COW_LIST_H__
+
+#include "main.h"
+#include <memory>
+#include <vector>
+
+/**
+ * @class CowList
+ * @brief Copy-on-write list with O(1) snapshots
+ *
+ * Elements live in chunks (leaves of up to LEAF_CAPACITY elements) under a
+ * balanced tree of up to BRANCH children per node; every node knows how
+ * many elements it holds, so positions are found in O(log n). Nodes are
+ * reference counted and shared: copying a CowList or taking a snapshot()
+ * copies one pointer. A write changes nodes it owns alone in place and
+ * first copies any node it shares, so after a snapshot the writer pays for
+ * the root-to-leaf path of each position it changes and nothing else.
+ *
+ * One thread may write a CowList while any number of threads read
+ * snapshots of it. get() returns a const reference because writing through
+ * it would leak into shared chunks; use set() instead.
+ */
+template <typename T>
+class CowList
+{
+public:
+    // Chunks of about 512 bytes, but never fewer than 8 elements
+    static const int LEAF_CAPACITY = (512 / sizeof(T)) > 8 ? int(512 / sizeof(T)) : 8;
+    static const int BRANCH = 16;
+
+    class Snapshot;
+
+private:
+    struct Node
+    {
+        int size = 0;                                // elements below this node
+        std::vector<T> items;                        // leaves only
+        std::vector<std::shared_ptr<Node>> children; // inner nodes only, never empty there
+
+        bool isLeaf() const
+        {
+            return children.empty();
+        }
+    };
+
+    std::shared_ptr<Node> root; // null when empty
+
+    // The node in slot, copied first unless this is its only owner
+    static Node *own(std::shared_ptr<Node> &slot);
+    // Child of an inner node holding position index, which becomes the offset in that child.
+    // With inserting set, a position at a child boundary goes to the end of the left child.
+    static int childFor(const Node *node, int &index, bool inserting);
+    // Returns the new right sibling when the node had to split
+    static std::shared_ptr<Node> insertInto(std::shared_ptr<Node> &slot, int index, const T &data);
+    static void eraseFrom(std::shared_ptr<Node> &slot, int index);
+    // Merge or rebalance child i with a sibling after it fell below half full
+    static void fixChild(Node *parent, int i);
+    // Calls fn(items, count) for every leaf in order until it returns false
+    template <typename Fn>
+    static bool forEachLeaf(const Node *node, Fn &fn);
+
+public:
+    CowList() = default;
+
+    int size() const;
+    bool empty() const;
+    const T &get(int index) const;
+    void set(int index, const T &data);
+    void insertAtHead(const T &data);
+    void insertAtTail(const T &data);
+    void insertAt(int index, const T &data);
+    void deleteAt(int index);
+    int indexOf(const T &item) const;
+    bool contains(const T &item) const;
+    void clear();
+    string toString(string (*convert2str)(T &) = 0) const;
+    // Append the same text to out; reuses out's capacity across calls
+    void toString(string &out) const;
+
+    template <typename InputIt>
+    void appendRange(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            insertAtTail(*first);
+    }
+
+    // Read-only view of the current contents, sharing every node; O(1)
+    Snapshot snapshot() const;
+
+    /**
+     * @class Iterator
+     * @brief Read-only bidirectional iterator that walks the chunks in order
+     *
+     * Valid while the list or snapshot it came from is alive and unchanged.
+     */
+    class Iterator
+    {
+        friend class CowList;
+
+    private:
+        struct Frame
+        {
+            const Node *node;
+            int child;
+        };
+        const Node *root;
+        std::vector<Frame> path; // inner nodes from the root down to the current leaf
+        const Node *leaf = nullptr;
+        int offset = 0;
+        int pos;
+
+        Iterator(const Node *root, int pos) : root(root), pos(pos)
+        {
+            if (root && pos < root->size)
+                seek(pos);
+        }
+
+        void seek(int index)
+        {
+            path.clear();
+            const Node *node = root;
+            while (!node->isLeaf())
+            {
+                int i = childFor(node, index, false);
+                path.push_back(Frame{node, i});
+                node = node->children[i].get();
+            }
+            leaf = node;
+            offset = index;
+        }
+
+        // Descend to the first (or last) element below node
+        void descend(const Node *node, bool first)
+        {
+            while (!node->isLeaf())
+            {
+                int i = first ? 0 : int(node->children.size()) - 1;
+                path.push_back(Frame{node, i});
+                node = node->children[i].get();
+            }
+            leaf = node;
+            offset = first ? 0 : int(node->items.size()) - 1;
+        }
+
+    public:
+        const T &operator*() const
+        {
+            return leaf->items[offset];
+        }
+
+        Iterator &operator++()
+        {
+            ++pos;
+            if (++offset < int(leaf->items.size()))
+                return *this;
+            while (!path.empty())
+            {
+                Frame &top = path.back();
+                if (top.child + 1 < int(top.node->children.size()))
+                {
+                    ++top.child;
+                    descend(top.node->children[top.child].get(), true);
+                    return *this;
+                }
+                path.pop_back();
+            }
+            leaf = nullptr; // reached end()
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Iterator &operator--()
+        {
+            --pos;
+            if (!leaf)
+            {
+                seek(pos); // stepping back from end()
+                return *this;
+            }
+            if (--offset >= 0)
+                return *this;
+            while (!path.empty())
+            {
+                Frame &top = path.back();
+                if (top.child > 0)
+                {
+                    --top.child;
+                    descend(top.node->children[top.child].get(), false);
+                    return *this;
+                }
+                path.pop_back();
+            }
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return pos == other.pos && root == other.root;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    Iterator begin() const
+    {
+        return Iterator(root.get(), 0);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(root.get(), size());
+    }
+};
+
+/**
+ * @class CowList::Snapshot
+ * @brief Immutable view of a CowList at the moment snapshot() was called
+ *
+ * Copies are O(1) and may be handed to other threads; later writes to the
+ * list never show through.
+ */
+template <typename T>
+class CowList<T>::Snapshot
+{
+    friend class CowList;
+
+private:
+    CowList list;
+
+    explicit Snapshot(const CowList &list) : list(list) {}
+
+public:
+    Snapshot() = default;
+
+    int size() const
+    {
+        return list.size();
+    }
+
+    bool empty() const
+    {
+        return list.empty();
+    }
+
+    const T &get(int index) const
+    {
+        return list.get(index);
+    }
+
+    int indexOf(const T &item) const
+    {
+        return list.indexOf(item);
+    }
+
+    bool contains(const T &item) const
+    {
+        return list.contains(item);
+    }
+
+    string toString(string (*convert2str)(T &) = 0) const
+    {
+        return list.toString(convert2str);
+    }
+
+    void toString(string &out) const
+    {
+        list.toString(out);
+    }
+
+    Iterator begin() const
+    {
+        return list.begin();
+    }
+
+    Iterator end() const
+    {
+        return list.end();
+    }
+};
+
+#endif // __COW_LIST_H__
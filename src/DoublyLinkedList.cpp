@@ -1,137 +1,584 @@
 #include "DoublyLinkedList.h"
-#include <sstream>
+#include "BinaryFormat.h"
+#include "ValueFormat.h"
+#include <cstring>
 
 template <typename T>
-DoublyLinkedList<T>::DoublyLinkedList() : length(0)
+DoublyLinkedList<T>::DoublyLinkedList() : head(&headSentinel), tail(&tailSentinel), length(0)
 {
-    head = new Node(); // dummy head
-    tail = new Node(); // dummy tail
     head->next = tail;
     tail->prev = head;
 }
 
+template <typename T>
+DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList &other) : DoublyLinkedList()
+{
+    nodePool().reserve(other.length); // one page holds the whole copy
+    appendCopies(other.head->next, other.tail);
+    reversed = other.reversed; // copy the physical order and the orientation bit
+    if (other.index)
+        enableIndex();
+    if (other.hashIndex)
+        enableHashIndex();
+}
+
+template <typename T>
+DoublyLinkedList<T>::DoublyLinkedList(DoublyLinkedList &&other) noexcept : DoublyLinkedList()
+{
+    takeNodes(other);
+}
+
 template <typename T>
 DoublyLinkedList<T>::~DoublyLinkedList()
 {
-    Node *curr = head;
-    while (curr)
+    // The pool frees whole pages; nodes only need visiting to run ~T, to
+    // hand their slots back to a pool other lists keep using or to count
+    // them as freed in instrumented builds
+#ifdef DLL_INSTRUMENT
+    clear();
+#else
+    bool poolShared = pool && (pool.use_count() > 1 || pool->isMerged());
+    if (!std::is_trivially_destructible<T>::value || poolShared)
+        clear();
+#endif
+    delete index;
+    delete hashIndex;
+}
+
+template <typename T>
+DoublyLinkedList<T> &DoublyLinkedList<T>::operator=(const DoublyLinkedList &other)
+{
+    if (this == &other)
+        return *this;
+
+    // Index settings follow other, as in the copy constructor. Indexes other
+    // lacks go now; new ones start empty and are filled by the rebuild below.
+    if (!other.index)
+        disableIndex();
+    else if (!index)
+        index = new PositionIndex<Node>();
+    if (!other.hashIndex)
+        disableHashIndex();
+    else if (!hashIndex)
+        hashIndex = new HashIndex();
+
+    // Reuse the nodes we already own, then grow or shrink to other's length.
+    // Physical order is copied as-is together with the orientation bit.
+    reversed = other.reversed;
+    Node *dst = head->next;
+    const Node *src = other.head->next;
+    try
     {
-        Node *tmp = curr;
-        curr = curr->next;
-        delete tmp;
+        while (dst != tail && src != other.tail)
+        {
+            dst->data = src->data;
+            dst = dst->next;
+            src = src->next;
+        }
     }
+    catch (...)
+    {
+        // Some nodes already hold other's values: bring the indexes back in line
+        rebuildIndex();
+        rebuildHashIndex();
+        throw;
+    }
+
+    if (src != other.tail)
+    {
+        nodePool().reserve(other.length - length);
+        appendCopies(src, other.tail); // rebuilds both indexes, even when it throws
+    }
+    else
+    {
+        Node *last = dst->prev;
+        while (dst != tail)
+        {
+            Node *tmp = dst;
+            dst = dst->next;
+            destroyNode(tmp);
+        }
+        last->next = tail;
+        tail->prev = last;
+        length = other.length;
+        rebuildIndex();
+        rebuildHashIndex(); // reused nodes now hold other values
+    }
+    return *this;
 }
 
-// TODO implement DoublyLinkedList
 template <typename T>
-void DoublyLinkedList<T>::insertAtHead(T data)
+DoublyLinkedList<T> &DoublyLinkedList<T>::operator=(DoublyLinkedList &&other) noexcept
 {
-    Node *newNode = new Node(data, head, head->next);
-    head->next->prev = newNode;
-    head->next = newNode;
-    length++;
+    if (this != &other)
+    {
+        clear();
+        takeNodes(other);
+    }
+    return *this;
 }
 
 template <typename T>
-void DoublyLinkedList<T>::insertAtTail(T data)
+void DoublyLinkedList<T>::swap(DoublyLinkedList &other) noexcept
 {
-    Node *newNode = new Node(data, tail->prev, tail);
-    tail->prev->next = newNode;
-    tail->prev = newNode;
-    length++;
+    if (this == &other)
+        return;
+    // Only the real nodes change owner; each list keeps its own sentinels
+    DoublyLinkedList tmp(std::move(other));
+    other.takeNodes(*this);
+    takeNodes(tmp);
 }
 
 template <typename T>
-void DoublyLinkedList<T>::insertAt(int index, T data)
+void DoublyLinkedList<T>::clear()
 {
-    if (index < 0 || index > length)
-        throw std::out_of_range("insertAt index out of range");
-    if (index == 0)
+    DLL_OP(CLEAR);
+    Node *curr = head->next;
+    while (curr != tail)
     {
-        insertAtHead(data);
-        return;
+        Node *tmp = curr;
+        curr = curr->next;
+        destroyNode(tmp);
     }
-    if (index == length)
+    head->next = tail;
+    tail->prev = head;
+    length = 0;
+    reversed = false;
+    forgetPositions();
+    if (index)
+        index->clear();
+    if (hashIndex)
+        hashIndex->clear();
+}
+
+template <typename T>
+void DoublyLinkedList<T>::appendCopies(const Node *first, const Node *last)
+{
+    Node *prev = tail->prev;
+    int added = 0;
+    try
+    {
+        for (const Node *curr = first; curr != last; curr = curr->next, ++added)
+        {
+            Node *newNode = createNode(curr->data, prev, nullptr);
+            prev->next = newNode;
+            prev = newNode;
+        }
+    }
+    catch (...)
     {
-        insertAtTail(data);
+        // Keep the nodes built so far so the destructor can release them
+        prev->next = tail;
+        tail->prev = prev;
+        length += added;
+        rebuildIndex();
+        rebuildHashIndex();
+        throw;
+    }
+    prev->next = tail;
+    tail->prev = prev;
+    length += added;
+    rebuildIndex();
+    rebuildHashIndex();
+}
+
+template <typename T>
+void DoublyLinkedList<T>::attachChain(Chain &chain)
+{
+    if (chain.count == 0)
         return;
+    Node *pos = physicalBefore(endNode());
+    chain.first->prev = pos->prev;
+    chain.last->next = pos;
+    pos->prev->next = chain.first;
+    pos->prev = chain.last;
+    length += chain.count;
+    rebuildIndex();
+    if (hashIndex)
+    {
+        for (Node *curr = chain.first; curr != pos; curr = curr->next)
+            hashIndex->emplace(curr->data, curr);
     }
+    chain = Chain();
+}
 
-    // find node currently at position index
+template <typename T>
+void DoublyLinkedList<T>::destroyChain(Chain &chain)
+{
+    Node *curr = chain.first;
+    for (int i = 0; i < chain.count; ++i)
+    {
+        Node *next = curr->next;
+        destroyNode(curr);
+        curr = next;
+    }
+    chain = Chain();
+}
+
+template <typename T>
+void DoublyLinkedList<T>::takeNodes(DoublyLinkedList &other)
+{
+    forgetPositions();
+    other.forgetPositions();
+    pool.swap(other.pool); // this is empty, so other gets back only free slots
+    std::swap(index, other.index); // the indexes travel with the nodes they point to
+    std::swap(hashIndex, other.hashIndex);
+    reversed = other.reversed;
+    other.reversed = false;
+    if (other.length == 0)
+        return;
+    Node *first = other.head->next;
+    Node *last = other.tail->prev;
+    head->next = first;
+    first->prev = head;
+    tail->prev = last;
+    last->next = tail;
+    length = other.length;
+
+    other.head->next = other.tail;
+    other.tail->prev = other.head;
+    other.length = 0;
+}
+
+template <typename T>
+typename DoublyLinkedList<T>::Node *DoublyLinkedList<T>::nodeAt(int index) const
+{
+    if (index == length)
+        return endNode();
+    if (reversed)
+        index = length - 1 - index; // everything below works on physical positions
+
+    // Start from whichever is nearest: the head, the tail or the last node reached
+    const int INDEX_WALK_LIMIT = 32;
+    int fromHead = index;
+    int fromTail = length - 1 - index;
+    int fromCache = !cachedNode ? length : index > cachedPos ? index - cachedPos : cachedPos - index;
+    int steps = std::min(fromCache, std::min(fromHead, fromTail));
     Node *curr;
-    if (index <= length / 2)
+    if (this->index && steps > INDEX_WALK_LIMIT)
     {
-        curr = head->next;
-        for (int i = 0; i < index; ++i)
-            curr = curr->next;
+        // The walk sample for an indexed lookup is its descent depth
+        int depth = 0;
+        curr = this->index->at(index, &depth);
+        DLL_WALKED(depth);
     }
     else
     {
-        curr = tail;
-        for (int i = length; i > index; --i)
+        DLL_WALKED(steps);
+        int pos;
+        if (steps == fromCache)
+        {
+            curr = cachedNode;
+            pos = cachedPos;
+        }
+        else if (steps == fromHead)
+        {
+            curr = head->next;
+            pos = 0;
+        }
+        else
+        {
+            curr = tail->prev;
+            pos = length - 1;
+        }
+        for (; pos < index; ++pos)
+            curr = curr->next;
+        for (; pos > index; --pos)
             curr = curr->prev;
     }
-    // insert before curr
-    Node *newNode = new Node(data, curr->prev, curr);
-    curr->prev->next = newNode;
-    curr->prev = newNode;
-    length++;
+    return curr;
 }
 
 template <typename T>
-void DoublyLinkedList<T>::deleteAt(int index)
+typename DoublyLinkedList<T>::Node *DoublyLinkedList<T>::seek(int index)
 {
-    if (index < 0 || index >= length)
-        throw std::out_of_range("deleteAt index out of range");
+    Node *node = nodeAt(index);
+    if (index < length)
+    {
+        cachedNode = node;
+        cachedPos = reversed ? length - 1 - index : index;
+    }
+    return node;
+}
 
-    Node *curr;
-    if (index < length / 2)
+template <typename T>
+std::vector<typename DoublyLinkedList<T>::Node *> DoublyLinkedList<T>::splitPoints(int parts) const
+{
+    if (parts > length)
+        parts = std::max(length, 1);
+    std::vector<Node *> bounds;
+    bounds.reserve(parts + 1);
+    if (index)
     {
-        curr = head->next;
-        for (int i = 0; i < index; ++i)
-            curr = curr->next;
+        for (int s = 0; s < parts; ++s)
+            bounds.push_back(nodeAt(int(std::int64_t(length) * s / parts)));
     }
     else
     {
-        curr = tail->prev;
-        for (int i = length - 1; i > index; --i)
-            curr = curr->prev;
+        // One walk, dropping a boundary every length / parts nodes
+        int s = 0;
+        int pos = 0;
+        for (Node *curr = firstNode(); s < parts; curr = nextOf(curr), ++pos)
+        {
+            if (pos == int(std::int64_t(length) * s / parts))
+            {
+                bounds.push_back(curr);
+                ++s;
+            }
+        }
     }
+    bounds.push_back(endNode());
+    return bounds;
+}
 
-    curr->prev->next = curr->next;
-    curr->next->prev = curr->prev;
-    delete curr;
+template <typename T>
+void DoublyLinkedList<T>::relinkSorted(Node *first)
+{
+    Node *Node::*fwd = reversed ? &Node::prev : &Node::next;
+    Node *Node::*back = reversed ? &Node::next : &Node::prev;
+    Node *start = reversed ? tail : head;
+    Node *prev = start;
+    for (Node *curr = first; curr; curr = curr->*fwd)
+    {
+        curr->*back = prev;
+        prev = curr;
+    }
+    start->*fwd = first;
+    prev->*fwd = endNode();
+    endNode()->*back = prev;
+    rebuildIndex(); // positions changed; the hash index maps values to the same nodes
+}
+
+template <typename T>
+void DoublyLinkedList<T>::linkBefore(Node *pos, Node *newNode)
+{
+    if (index)
+        newNode->entry = index->insertBefore(pos == tail ? nullptr : pos->entry, newNode);
+    if (hashIndex)
+        hashIndex->emplace(newNode->data, newNode);
+    ++modifications;
+    if (cachedNode)
+    {
+        if (pos == cachedNode)
+            cachedNode = newNode; // takes over the cached position
+        else if (pos == head->next)
+            ++cachedPos;
+        else if (pos != tail && pos != cachedNode->next)
+            cachedNode = nullptr; // somewhere unknown relative to the cache
+    }
+    newNode->prev = pos->prev;
+    newNode->next = pos;
+    pos->prev->next = newNode;
+    pos->prev = newNode;
+    length++;
+}
+
+template <typename T>
+void DoublyLinkedList<T>::unlink(Node *node)
+{
+    if (index)
+        index->erase(node->entry);
+    if (hashIndex)
+    {
+        auto range = hashIndex->equal_range(node->data);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == node)
+            {
+                hashIndex->erase(it);
+                break;
+            }
+        }
+    }
+    ++modifications;
+    if (cachedNode)
+    {
+        if (node == cachedNode)
+            cachedNode = node->next != tail ? node->next : nullptr; // the successor slides into place
+        else if (node == head->next)
+            --cachedPos;
+        else if (node != tail->prev && node != cachedNode->next)
+            cachedNode = nullptr;
+    }
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
     length--;
 }
 
 template <typename T>
-T &DoublyLinkedList<T>::get(int index) const
+void DoublyLinkedList<T>::rebuildIndex()
 {
-    if (index < 0 || index >= length)
-        throw std::out_of_range("get index out of range");
+    forgetPositions(); // bulk relinks all end up here
+    if (!index)
+        return;
+    index->build(
+        head->next, tail,
+        [](Node *n) { return n->next; },
+        [](Node *n) -> typename PositionIndex<Node>::Entry *& { return n->entry; });
+}
 
-    const Node *curr;
-    if (index < length / 2)
+template <typename T>
+void DoublyLinkedList<T>::rebuildHashIndex()
+{
+    if (!hashIndex)
+        return;
+    hashIndex->clear();
+    hashIndex->reserve(length);
+    for (Node *curr = head->next; curr != tail; curr = curr->next)
+        hashIndex->emplace(curr->data, curr);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::transfer(Node *pos, DoublyLinkedList &other, Node *first, Node *last, int count)
+{
+    if (first == last || (this == &other && (pos == first || pos == last)))
+        return; // nothing moves
+    // Physical bounds a..b of the range inside other
+    Node *a = other.reversed ? last->next : first;
+    Node *b = other.reversed ? first : last->prev;
+    bool flip = other.reversed != reversed;
+
+    if ((count < 0 && this != &other) || flip)
     {
-        curr = head->next;
-        for (int i = 0; i < index; ++i)
-            curr = curr->next;
+        int n = 0;
+        Node *stop = b->next;
+        for (Node *curr = a; curr != stop;)
+        {
+            Node *next = curr->next;
+            if (flip)
+                std::swap(curr->prev, curr->next);
+            curr = next;
+            ++n;
+        }
+        count = n;
     }
-    else
+
+    // Detach from other (links around the range are still the original ones)
+    Node *before = flip ? a->next : a->prev;
+    Node *after = flip ? b->prev : b->next;
+    before->next = after;
+    after->prev = before;
+    if (flip)
+        std::swap(a, b);
+
+    // pos is still linked, so its physical neighbour is valid again
+    Node *at = physicalBefore(pos);
+    a->prev = at->prev;
+    b->next = at;
+    at->prev->next = a;
+    at->prev = b;
+
+    if (this != &other)
     {
-        curr = tail->prev;
-        for (int i = length - 1; i > index; --i)
-            curr = curr->prev;
+        other.length -= count;
+        length += count;
+        SharedNodePool<Node>::join(pool, other.pool);
+        other.rebuildIndex();
+        other.rebuildHashIndex();
+        rebuildHashIndex();
     }
-    // Header declares non-const reference; cast away constness
-    return const_cast<T &>(curr->data);
+    rebuildIndex();
+}
+
+// TODO implement DoublyLinkedList
+template <typename T>
+void DoublyLinkedList<T>::insertAtHead(const T &data)
+{
+    emplaceAtHead(data);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::insertAtHead(T &&data)
+{
+    emplaceAtHead(std::move(data));
+}
+
+template <typename T>
+void DoublyLinkedList<T>::insertAtTail(const T &data)
+{
+    emplaceAtTail(data);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::insertAtTail(T &&data)
+{
+    emplaceAtTail(std::move(data));
+}
+
+template <typename T>
+void DoublyLinkedList<T>::insertAt(int index, const T &data)
+{
+    if (index < 0 || index > length)
+        throw std::out_of_range("insertAt index out of range");
+    // insert before the node currently at position index
+    emplaceAt(index, data);
 }
 
 template <typename T>
-int DoublyLinkedList<T>::indexOf(T item) const
+void DoublyLinkedList<T>::insertAt(int index, T &&data)
 {
+    if (index < 0 || index > length)
+        throw std::out_of_range("insertAt index out of range");
+    emplaceAt(index, std::move(data));
+}
+
+template <typename T>
+void DoublyLinkedList<T>::deleteAt(int index)
+{
+    DLL_OP(DELETE_AT);
+    if (index < 0 || index >= length)
+        throw std::out_of_range("deleteAt index out of range");
+
+    Node *curr = seek(index);
+    unlink(curr);
+    destroyNode(curr);
+}
+
+template <typename T>
+T &DoublyLinkedList<T>::get(int index)
+{
+    DLL_OP(GET);
+    if (index < 0 || index >= length)
+        throw std::out_of_range("get index out of range");
+    return seek(index)->data;
+}
+
+template <typename T>
+T &DoublyLinkedList<T>::get(int index) const
+{
+    DLL_OP(GET);
+    if (index < 0 || index >= length)
+        throw std::out_of_range("get index out of range");
+    return nodeAt(index)->data;
+}
+
+template <typename T>
+int DoublyLinkedList<T>::indexOf(const T &item) const
+{
+    DLL_OP(INDEX_OF);
+    if (hashIndex)
+    {
+        auto range = hashIndex->equal_range(item);
+        if (range.first == range.second)
+            return -1;
+        if (index)
+        {
+            // The first occurrence is the match with the smallest rank
+            int best = length;
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                int rank = index->rankOf(it->second->entry);
+                if (reversed)
+                    rank = length - 1 - rank;
+                if (rank < best)
+                    best = rank;
+            }
+            return best;
+        }
+    }
+
     int idx = 0;
-    for (Node *curr = head->next; curr != tail; curr = curr->next, ++idx)
+    for (Node *curr = firstNode(); curr != endNode(); curr = nextOf(curr), ++idx)
     {
         if (curr->data == item)
             return idx;
@@ -140,11 +587,115 @@ int DoublyLinkedList<T>::indexOf(T item) const
 }
 
 template <typename T>
-bool DoublyLinkedList<T>::contains(T item) const
+bool DoublyLinkedList<T>::contains(const T &item) const
 {
+    DLL_OP(CONTAINS);
+    if (hashIndex)
+        return hashIndex->find(item) != hashIndex->end();
     return indexOf(item) != -1;
 }
 
+template <typename T>
+typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::findNode(const T &item) const
+{
+    DLL_OP(FIND_NODE);
+    if (hashIndex)
+    {
+        auto it = hashIndex->find(item);
+        return it == hashIndex->end() ? end() : Iterator(it->second, reversed);
+    }
+    for (Node *curr = firstNode(); curr != endNode(); curr = nextOf(curr))
+    {
+        if (curr->data == item)
+            return Iterator(curr, reversed);
+    }
+    return end();
+}
+
+template <typename T>
+void DoublyLinkedList<T>::splice(Iterator pos, DoublyLinkedList &other, Iterator first, Iterator last)
+{
+    DLL_OP(SPLICE);
+    bool whole = first.current == other.firstNode() && last.current == other.endNode();
+    transfer(pos.current, other, first.current, last.current, whole && this != &other ? other.length : -1);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::append(DoublyLinkedList &&other)
+{
+    DLL_OP(SPLICE);
+    if (this == &other)
+        return;
+    transfer(endNode(), other, other.firstNode(), other.endNode(), other.length);
+}
+
+template <typename T>
+DoublyLinkedList<T> DoublyLinkedList<T>::splitAt(Iterator pos)
+{
+    DLL_OP(SPLICE);
+    DoublyLinkedList result;
+    result.reversed = reversed; // same orientation, so no flip pass
+    result.transfer(result.endNode(), *this, pos.current, endNode(), -1);
+    if (index)
+        result.enableIndex();
+    if (hashIndex)
+        result.enableHashIndex();
+    return result;
+}
+
+template <typename T>
+typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::insert(Iterator pos, const T &data)
+{
+    return emplace(pos, data);
+}
+
+template <typename T>
+typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::insert(Iterator pos, T &&data)
+{
+    return emplace(pos, std::move(data));
+}
+
+template <typename T>
+typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::erase(Iterator pos)
+{
+    DLL_OP(ERASE);
+    if (pos.current == head || pos.current == tail)
+        throw std::out_of_range("erase at end()");
+    Node *next = nextOf(pos.current);
+    unlink(pos.current);
+    destroyNode(pos.current);
+    return Iterator(next, reversed);
+}
+
+template <typename T>
+int DoublyLinkedList<T>::countOf(const T &item) const
+{
+    DLL_OP(COUNT_OF);
+    int total = 0;
+    for (Node *curr = head->next; curr != tail; curr = curr->next)
+    {
+        if (curr->data == item)
+            ++total;
+    }
+    return total;
+}
+
+template <typename T>
+int DoublyLinkedList<T>::indexOfAny(const T *items, int count) const
+{
+    DLL_OP(INDEX_OF_ANY);
+    int idx = 0;
+    for (Node *curr = firstNode(); curr != endNode(); curr = nextOf(curr), ++idx)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (curr->data == items[i])
+                return idx;
+        }
+    }
+    return -1;
+}
+
 template <typename T>
 int DoublyLinkedList<T>::size() const
 {
@@ -154,45 +705,210 @@ int DoublyLinkedList<T>::size() const
 template <typename T>
 void DoublyLinkedList<T>::reverse()
 {
-    // Reverse links for all nodes including sentinels, then swap head/tail pointers
-    Node *curr = head;
-    while (curr)
+    DLL_OP(REVERSE);
+    // O(1): links stay as they are and every logical walk changes direction
+    reversed = !reversed;
+    ++modifications; // cached physical positions stay valid, cursor positions do not
+}
+
+template <typename T>
+void DoublyLinkedList<T>::enableIndex()
+{
+    if (index)
+        return;
+    index = new PositionIndex<Node>();
+    rebuildIndex();
+}
+
+template <typename T>
+void DoublyLinkedList<T>::disableIndex()
+{
+    delete index;
+    index = nullptr;
+}
+
+template <typename T>
+bool DoublyLinkedList<T>::isIndexed() const
+{
+    return index != nullptr;
+}
+
+template <typename T>
+void DoublyLinkedList<T>::enableHashIndex()
+{
+    if (hashIndex)
+        return;
+    if (!supportsHashIndex)
+        throw std::logic_error("enableHashIndex: element type has no std::hash");
+    hashIndex = new HashIndex();
+    rebuildHashIndex();
+}
+
+template <typename T>
+void DoublyLinkedList<T>::disableHashIndex()
+{
+    delete hashIndex;
+    hashIndex = nullptr;
+}
+
+template <typename T>
+bool DoublyLinkedList<T>::isHashIndexed() const
+{
+    return hashIndex != nullptr;
+}
+
+template <typename T>
+string DoublyLinkedList<T>::toString(string (*convert2str)(T &) /*= 0*/) const
+{
+    string out;
+    if (!convert2str)
     {
-        Node *next = curr->next;
-        curr->next = curr->prev;
-        curr->prev = next;
-        curr = next;
+        toString(out);
+        return out;
     }
-    Node *tmp = head;
-    head = tail;
-    tail = tmp;
+    DLL_OP(TO_STRING);
+    out += "[";
+    for (Node *curr = firstNode(); curr != endNode(); curr = nextOf(curr))
+    {
+        if (curr != firstNode())
+            out += ", ";
+        out += convert2str(const_cast<T &>(curr->data));
+    }
+    out += "]";
+    return out;
 }
 
 template <typename T>
-string DoublyLinkedList<T>::toString(string (*convert2str)(T &) /*= 0*/) const
+void DoublyLinkedList<T>::toString(string &out) const
 {
-    std::ostringstream oss;
-    oss << "[";
-    Node *curr = head->next;
-    bool first = true;
-    while (curr != tail)
+    DLL_OP(TO_STRING);
+    out.reserve(out.size() + 2 + std::size_t(length) * (ValueFormat::estimatedWidth<T>() + 2));
+    out += '[';
+    for (Node *curr = firstNode(); curr != endNode(); curr = nextOf(curr))
     {
-        if (!first)
-            oss << ", ";
-        first = false;
-        if (convert2str)
-        {
-            T &ref = const_cast<T &>(curr->data);
-            oss << convert2str(ref);
-        }
-        else
+        if (curr != firstNode())
+            out += ", ";
+        ValueFormat::append(out, curr->data);
+    }
+    out += ']';
+}
+
+template <typename T>
+typename DoublyLinkedList<T>::Cursor DoublyLinkedList<T>::cursor(int index)
+{
+    DLL_OP(CURSOR);
+    if (index < 0 || index > length)
+        throw cursor_error("cursor index out of range");
+    return Cursor(this, seek(index), index);
+}
+
+template <typename T>
+ListStats DoublyLinkedList<T>::stats() const
+{
+#ifdef DLL_INSTRUMENT
+    return statsRecorder.snapshot();
+#else
+    return ListStats();
+#endif
+}
+
+template <typename T>
+void DoublyLinkedList<T>::resetStats()
+{
+#ifdef DLL_INSTRUMENT
+    statsRecorder.reset();
+#endif
+}
+
+template <typename T>
+void DoublyLinkedList<T>::appendDelimited(std::istream &in, char delimiter)
+{
+    DLL_OP(APPEND_DELIMITED);
+    const std::size_t BLOCK = 1 << 16;
+    string buffer;   // unparsed tail of the previous block plus the new block
+    std::size_t start = 0; // first byte of the field being scanned
+    Chain chain;
+    long long field = 0;
+
+    auto parseField = [&](const char *first, const char *last) {
+        if (delimiter == '\n' && last != first && last[-1] == '\r')
+            --last;
+        Node *node = createNode(std::in_place);
+        chainPush(chain, node);
+        if (!ValueFormat::parse(first, last, node->data))
+            throw std::runtime_error("cannot parse field " + std::to_string(field) + ": \"" + string(first, last) + "\"");
+        ++field;
+    };
+
+    try
+    {
+        while (in)
         {
-            oss << curr->data;
+            // Drop consumed bytes, then read the next block behind the leftovers
+            buffer.erase(0, start);
+            start = 0;
+            std::size_t kept = buffer.size();
+            buffer.resize(kept + BLOCK);
+            in.read(&buffer[kept], std::streamsize(BLOCK));
+            buffer.resize(kept + std::size_t(in.gcount()));
+
+            const char *data = buffer.data();
+            const char *end = data + buffer.size();
+            for (const char *p = data + kept; (p = static_cast<const char *>(std::memchr(p, delimiter, std::size_t(end - p))));)
+            {
+                parseField(data + start, p);
+                start = std::size_t(++p - data);
+            }
         }
-        curr = curr->next;
+        if (start < buffer.size())
+            parseField(buffer.data() + start, buffer.data() + buffer.size());
     }
-    oss << "]";
-    return oss.str();
+    catch (...)
+    {
+        destroyChain(chain);
+        throw;
+    }
+    attachChain(chain);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::saveBinary(std::ostream &out) const
+{
+    DLL_OP(SAVE_BINARY);
+    BinaryFormat::Writer writer(out);
+    writer.header(BinaryFormat::tagOf<T>(), std::uint64_t(length));
+    for (Node *curr = firstNode(); curr != endNode(); curr = nextOf(curr))
+        writer.write(curr->data);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::saveBinary(const string &path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("cannot create " + path);
+    saveBinary(out);
+    out.flush();
+    if (!out)
+        throw std::runtime_error("failed writing " + path);
+}
+
+template <typename T>
+DoublyLinkedList<T> DoublyLinkedList<T>::loadBinary(const string &path)
+{
+    BinaryFormat::MappedFile file(path);
+    BinaryFormat::Reader reader(file.data(), file.size());
+    std::uint64_t count = reader.header(BinaryFormat::tagOf<T>());
+    // Every element takes at least one byte, which bounds a corrupt count
+    if (count > reader.remaining())
+        throw std::runtime_error("binary list data is truncated");
+
+    DoublyLinkedList result;
+    DLL_OP_OF(result, LOAD_BINARY);
+    result.nodePool().reserve(std::size_t(count));
+    for (std::uint64_t i = 0; i < count; ++i)
+        reader.read(result.emplaceAtTail());
+    return result;
 }
 
 // Explicit template instantiation for char, string, int, double, float, and Point
@@ -2,7 +2,30 @@
 #define __DOUBLY_LINKED_LIST_H__
 
 #include "main.h"
+#include "ListStats.h"
+#include "NodePool.h"
+#include "PositionIndex.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+/**
+ * @class DoublyLinkedList
+ * @brief Doubly linked list with O(1) reverse and optional position and hash indexes
+ *
+ * Only const members may run concurrently, and only while no thread calls
+ * a non-const one. This is stricter than the standard containers: the
+ * non-const get() and cursor() move the position cache, so two threads
+ * calling them on one list race even though neither changes an element.
+ * Concurrent readers should go through a const reference so they reach
+ * the const get(), which reads the cache but never writes it. Builds with
+ * -DDLL_INSTRUMENT are stricter still: their counters are written by const
+ * calls too, so no two calls may overlap.
+ */
 template <typename T>
 class DoublyLinkedList
 {
@@ -13,37 +36,360 @@ private:
         T data;
         Node *prev;
         Node *next;
+        typename PositionIndex<Node>::Entry *entry = nullptr; // only used in indexed mode
         Node() : prev(nullptr), next(nullptr) {}
         Node(const T &val, Node *prev = nullptr, Node *next = nullptr) : data(val), prev(prev), next(next) {}
+        // Builds data directly from constructor arguments
+        template <typename... Args>
+        Node(std::in_place_t, Args &&...args) : data(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
     };
 
+    // Sentinels live inside the list object so that moving a list never allocates
+    Node headSentinel;
+    Node tailSentinel;
     Node *head; // Dummy head
     Node *tail; // Dummy tail
     int length=0;
+    // Logical order runs tail -> head when set; reverse() only flips this bit
+    bool reversed = false;
+    // Every real node comes from here. Created on first use and shared with
+    // the lists this one exchanged nodes with (splice/append/splitAt).
+    std::shared_ptr<SharedNodePool<Node>> pool;
+    PositionIndex<Node> *index = nullptr; // order-statistic tree, null unless indexed
+    // Last node seek() reached and its physical position, so that neighbouring
+    // index accesses walk a step or two instead of starting from a sentinel.
+    // Only non-const members write it; const lookups read it but never move it.
+    Node *cachedNode = nullptr;
+    int cachedPos = 0;
+    // Bumped by every structural change; a Cursor uses it to notice it went stale
+    unsigned modifications = 0;
+
+    // Compiles for every T; enableHashIndex refuses types without std::hash
+    struct ValueHash
+    {
+        std::size_t operator()(const T &value) const
+        {
+            if constexpr (std::is_default_constructible<std::hash<T>>::value)
+                return std::hash<T>()(value);
+            else
+                return 0;
+        }
+    };
+    typedef std::unordered_multimap<T, Node *, ValueHash> HashIndex;
+    HashIndex *hashIndex = nullptr; // value -> nodes holding it, null unless enabled
+    DLL_STATS_MEMBER // counters, only with -DDLL_INSTRUMENT (see ListStats.h)
+
+    template <typename... Args>
+    Node *createNode(Args &&...args)
+    {
+        void *mem = nodePool().allocate();
+        try
+        {
+            Node *node = new (mem) Node(std::forward<Args>(args)...);
+            DLL_ALLOCATED();
+            return node;
+        }
+        catch (...)
+        {
+            pool->deallocate(mem);
+            throw;
+        }
+    }
+
+    void destroyNode(Node *node)
+    {
+        node->~Node();
+        pool->deallocate(node);
+        DLL_FREED();
+    }
+
+    SharedNodePool<Node> &nodePool()
+    {
+        if (!pool)
+            pool = std::make_shared<SharedNodePool<Node>>();
+        return *pool;
+    }
+
+    // Relink all nodes of other (this must be empty) in O(1)
+    void takeNodes(DoublyLinkedList &other);
+    // Append copies of [first, last) in one pass, linking the tail once at the end
+    void appendCopies(const Node *first, const Node *last);
+
+    // Nodes built off-list in physical order, then attached with one splice
+    struct Chain
+    {
+        Node *first = nullptr;
+        Node *last = nullptr;
+        int count = 0;
+    };
+    // Add node at the logical end of chain
+    void chainPush(Chain &chain, Node *node) const
+    {
+        if (!chain.first)
+        {
+            chain.first = chain.last = node;
+        }
+        else if (reversed)
+        {
+            node->next = chain.first;
+            chain.first->prev = node;
+            chain.first = node;
+        }
+        else
+        {
+            node->prev = chain.last;
+            chain.last->next = node;
+            chain.last = node;
+        }
+        ++chain.count;
+    }
+    // Link chain in at the logical tail and update length and indexes
+    void attachChain(Chain &chain);
+    void destroyChain(Chain &chain);
+
+    // Node at logical position index (0 <= index < length); the end sentinel when index == length.
+    // Starts from the nearest of the sentinels and the cached node, and leaves the cache alone.
+    Node *nodeAt(int index) const;
+    // nodeAt() that also moves the position cache to the node it returns
+    Node *seek(int index);
+    // Physical neighbour of a node in logical order
+    Node *nextOf(const Node *node) const { return reversed ? node->prev : node->next; }
+    Node *prevOf(const Node *node) const { return reversed ? node->next : node->prev; }
+    Node *firstNode() const { return reversed ? tail->prev : head->next; }
+    Node *endNode() const { return reversed ? head : tail; }
+    // Physical position for a node that must appear logically right before pos
+    Node *physicalBefore(Node *pos) const { return reversed ? pos->next : pos; }
+    // parts + 1 boundaries cutting the list into parts contiguous logical segments
+    std::vector<Node *> splitPoints(int parts) const;
+    // Segment count for parallel work: a few per worker, but not tiny ones
+    static int segmentCount(int length, int workers)
+    {
+        const int MIN_SEGMENT = 4096;
+        return std::max(1, std::min(workers * 4, length / MIN_SEGMENT));
+    }
+    // Stable merge of two null-terminated runs linked through fwd
+    template <typename Compare>
+    static Node *mergeRuns(Node *a, Node *b, Compare &comp, Node *Node::*fwd)
+    {
+        Node *result = nullptr;
+        Node **slot = &result;
+        while (a && b)
+        {
+            // Take from b only when strictly smaller, so equal elements keep their order
+            if (comp(b->data, a->data))
+            {
+                *slot = b;
+                b = b->*fwd;
+            }
+            else
+            {
+                *slot = a;
+                a = a->*fwd;
+            }
+            slot = &((*slot)->*fwd);
+        }
+        *slot = a ? a : b;
+        return result;
+    }
+    // Bottom-up merge sort of a null-terminated run; bins[i] holds a sorted run of 2^i nodes
+    template <typename Compare>
+    static Node *sortRun(Node *first, Compare &comp, Node *Node::*fwd)
+    {
+        Node *bins[64] = {};
+        int used = 0;
+        while (first)
+        {
+            Node *carry = first;
+            first = first->*fwd;
+            carry->*fwd = nullptr;
+            int i = 0;
+            for (; i < used && bins[i]; ++i)
+            {
+                carry = mergeRuns(bins[i], carry, comp, fwd); // bins[i] holds the earlier nodes
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            if (i == used)
+                ++used;
+        }
+        Node *result = nullptr;
+        for (int i = 0; i < used; ++i)
+        {
+            if (bins[i])
+                result = result ? mergeRuns(bins[i], result, comp, fwd) : bins[i];
+        }
+        return result;
+    }
+    // Link in the sorted logical chain starting at first: repairs the back links, the sentinels and the index
+    void relinkSorted(Node *first);
+    // Every single-node insert and delete goes through these two
+    void linkBefore(Node *pos, Node *newNode);
+    void unlink(Node *node);
+    void rebuildIndex();
+    void rebuildHashIndex();
+    // Called by every change that moves nodes without linkBefore/unlink
+    void forgetPositions()
+    {
+        cachedNode = nullptr;
+        ++modifications;
+    }
+    /**
+     * Move the logical range [first, last) of other in front of pos. count is
+     * the number of nodes in the range, or -1 to count them while relinking.
+     */
+    void transfer(Node *pos, DoublyLinkedList &other, Node *first, Node *last, int count);
 
 public:
     DoublyLinkedList();
+    DoublyLinkedList(const DoublyLinkedList &other);
+    DoublyLinkedList(DoublyLinkedList &&other) noexcept;
     ~DoublyLinkedList();
 
-    void insertAtHead(T data);
-    void insertAtTail(T data);
-    void insertAt(int index, T data);
+    // Overwrites this list's nodes in place and allocates or frees only the
+    // length difference; the result, index settings included, matches the
+    // copy constructor. If an element copy throws, the list keeps the nodes
+    // assigned so far and its indexes stay consistent with them.
+    DoublyLinkedList &operator=(const DoublyLinkedList &other);
+    DoublyLinkedList &operator=(DoublyLinkedList &&other) noexcept;
+    void swap(DoublyLinkedList &other) noexcept;
+    void clear();
+
+    void insertAtHead(const T &data);
+    void insertAtHead(T &&data);
+    void insertAtTail(const T &data);
+    void insertAtTail(T &&data);
+    void insertAt(int index, const T &data);
+    void insertAt(int index, T &&data);
+
+    // Construct the element directly inside its node
+    template <typename... Args>
+    T &emplaceAtHead(Args &&...args)
+    {
+        DLL_OP(INSERT_AT_HEAD);
+        Node *newNode = createNode(std::in_place, std::forward<Args>(args)...);
+        linkBefore(physicalBefore(firstNode()), newNode);
+        return newNode->data;
+    }
+
+    template <typename... Args>
+    T &emplaceAtTail(Args &&...args)
+    {
+        DLL_OP(INSERT_AT_TAIL);
+        Node *newNode = createNode(std::in_place, std::forward<Args>(args)...);
+        linkBefore(physicalBefore(endNode()), newNode);
+        return newNode->data;
+    }
+
+    template <typename... Args>
+    T &emplaceAt(int index, Args &&...args)
+    {
+        DLL_OP(INSERT_AT);
+        if (index < 0 || index > length)
+            throw std::out_of_range("emplaceAt index out of range");
+        Node *pos = seek(index);
+        Node *newNode = createNode(std::in_place, std::forward<Args>(args)...);
+        linkBefore(physicalBefore(pos), newNode);
+        return newNode->data;
+    }
+
     void deleteAt(int index);
+    // Both overloads reuse the position cache; only the non-const one moves it
+    T &get(int index);
     T &get(int index) const;
-    int indexOf(T item) const;
-    bool contains(T item) const;
+    // Linear scans with operator==, one node at a time: the values are not
+    // contiguous, so unlike UnrolledLinkedList these never use SimdSearch.
+    // For repeated lookups, enableHashIndex() is the fast path.
+    int indexOf(const T &item) const;
+    bool contains(const T &item) const;
+    int countOf(const T &item) const;
+    // First position holding any of items[0..count), or -1
+    int indexOfAny(const T *items, int count) const;
     int size() const;
     void reverse();
     string toString(string (*convert2str)(T &) = 0) const;
+    // Append the same text to out; reuses out's capacity across calls
+    void toString(string &out) const;
+    // Counters recorded so far; all zero unless built with -DDLL_INSTRUMENT
+    ListStats stats() const;
+    void resetStats();
+
+    // Binary snapshot in the BinaryFormat layout; loading throws std::runtime_error on a bad file
+    void saveBinary(std::ostream &out) const;
+    void saveBinary(const string &path) const;
+    static DoublyLinkedList loadBinary(const string &path);
+
+    /**
+     * Relinking operations; they never allocate or copy elements. Moving a
+     * range costs O(1) plus one pass over it when its size is not known
+     * (a partial range from another list) or when the two lists have
+     * opposite orientation. Enabled indexes are rebuilt afterwards.
+     */
+    void append(DoublyLinkedList &&other);
+
+    // Build nodes for [first, last) off-list and attach them to the tail in one step
+    template <typename InputIt>
+    void appendRange(InputIt first, InputIt last)
+    {
+        DLL_OP(APPEND_RANGE);
+        Chain chain;
+        try
+        {
+            for (; first != last; ++first)
+                chainPush(chain, createNode(std::in_place, *first));
+        }
+        catch (...)
+        {
+            destroyChain(chain);
+            throw;
+        }
+        attachChain(chain);
+    }
+
+    // Replace the contents with [first, last)
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        DLL_OP(ASSIGN);
+        clear();
+        appendRange(first, last);
+    }
+
+    /**
+     * Append one element per delimiter-separated field of in, parsed with
+     * ValueFormat::parse straight into the new nodes. A "\r\n" line ending
+     * counts as '\n' and a final empty field is ignored. Throws
+     * std::runtime_error on a malformed field, leaving the list unchanged.
+     */
+    void appendDelimited(std::istream &in, char delimiter = '\n');
+
+    // Indexed mode: get/insertAt/deleteAt in O(log n) for one extra tree entry per node
+    void enableIndex();
+    void disableIndex();
+    bool isIndexed() const;
+
+    /**
+     * Hash index: contains and findNode in O(1) expected, indexOf in
+     * O(k log n) for k matches when the position index is on too. Requires
+     * std::hash<T> (not available for Point). Elements must not be changed
+     * in place through get() or an Iterator while it is enabled; the
+     * parallel forEach and transform keep it up to date themselves.
+     */
+    void enableHashIndex();
+    void disableHashIndex();
+    bool isHashIndexed() const;
+    static constexpr bool supportsHashIndex = std::is_default_constructible<std::hash<T>>::value;
 
     class Iterator
     {
+        friend class DoublyLinkedList;
+
     private:
         Node *current;
+        bool backward; // walks prev links when the list is reversed
 
     public:
 
-        Iterator(Node *node) : current(node) {}
+        Iterator(Node *node, bool backward = false) : current(node), backward(backward) {}
 
         T &operator*() const
         {
@@ -52,27 +398,27 @@ public:
 
         Iterator &operator++()
         {
-            current = current->next;
+            current = backward ? current->prev : current->next;
             return *this;
         }
 
         Iterator operator++(int)
         {
             Iterator tmp = *this;
-            current = current->next;
+            ++*this;
             return tmp;
         }
 
         Iterator &operator--()
         {
-            current = current->prev;
+            current = backward ? current->next : current->prev;
             return *this;
         }
 
         Iterator operator--(int)
         {
             Iterator tmp = *this;
-            current = current->prev;
+            --*this;
             return tmp;
         }
 
@@ -87,14 +433,379 @@ public:
         }
     };
 
+    /**
+     * @class Cursor
+     * @brief A position in the list that moves, reads, inserts and erases
+     *
+     * Sits on an element or just past the last one (atEnd()), and every
+     * step is O(1). Invalid moves throw cursor_error, and so does any use
+     * after the list was changed other than through this cursor.
+     */
+    class Cursor
+    {
+        friend class DoublyLinkedList;
+
+    private:
+        DoublyLinkedList *list;
+        Node *current;
+        int pos;
+        unsigned seen; // list->modifications when this cursor last synced
+
+        Cursor(DoublyLinkedList *list, Node *node, int pos)
+            : list(list), current(node), pos(pos), seen(list->modifications) {}
+
+        void check() const
+        {
+            if (seen != list->modifications)
+                throw cursor_error("cursor used after the list was modified");
+        }
+
+    public:
+        int position() const
+        {
+            check();
+            return pos;
+        }
+
+        bool atEnd() const
+        {
+            check();
+            return current == list->endNode();
+        }
+
+        T &get() const
+        {
+            if (atEnd())
+                throw cursor_error("cursor at end has no element");
+            return current->data;
+        }
+
+        Cursor &moveNext()
+        {
+            if (atEnd())
+                throw cursor_error("moveNext past the end");
+            current = list->nextOf(current);
+            ++pos;
+            return *this;
+        }
+
+        Cursor &movePrev()
+        {
+            check();
+            if (pos == 0)
+                throw cursor_error("movePrev before the first element");
+            current = list->prevOf(current);
+            --pos;
+            return *this;
+        }
+
+        // Jump to index (0 <= index <= size()), walking from the nearest known node
+        Cursor &moveTo(int index)
+        {
+            check();
+            if (index < 0 || index > list->length)
+                throw cursor_error("moveTo index out of range");
+            current = list->seek(index);
+            pos = index;
+            return *this;
+        }
+
+        // Insert before the cursor; the cursor stays on the same element
+        void insert(const T &data)
+        {
+            check();
+            list->insert(Iterator(current, list->reversed), data);
+            ++pos;
+            seen = list->modifications;
+        }
+
+        // Erase the element under the cursor and move onto the one after it
+        void erase()
+        {
+            if (atEnd())
+                throw cursor_error("erase at end");
+            current = list->erase(Iterator(current, list->reversed)).current;
+            seen = list->modifications;
+        }
+    };
+
+    // Cursor on position index (0 <= index <= size()); throws cursor_error otherwise
+    Cursor cursor(int index = 0);
+
     Iterator begin() const
     {
-        return Iterator(head->next);
+        return Iterator(firstNode(), reversed);
     }
 
     Iterator end() const
     {
-        return Iterator(tail);
+        return Iterator(endNode(), reversed);
+    }
+
+    // Iterator to some node holding item (not necessarily the first), or end()
+    Iterator findNode(const T &item) const;
+
+    // Move [first, last) of other (which may be *this) in front of pos
+    void splice(Iterator pos, DoublyLinkedList &other, Iterator first, Iterator last);
+    // Cut [pos, end()) off into a new list
+    DoublyLinkedList splitAt(Iterator pos);
+
+    // Iterator-based editing: O(1) per call (O(log n) with the position index)
+    Iterator insert(Iterator pos, const T &data);
+    Iterator insert(Iterator pos, T &&data);
+    // Remove the element at pos and return an iterator to the one after it
+    Iterator erase(Iterator pos);
+
+    template <typename... Args>
+    Iterator emplace(Iterator pos, Args &&...args)
+    {
+        DLL_OP(INSERT);
+        Node *newNode = createNode(std::in_place, std::forward<Args>(args)...);
+        linkBefore(physicalBefore(pos.current), newNode);
+        return Iterator(newNode, reversed);
+    }
+
+    /**
+     * Parallel whole-list algorithms. The list is cut into contiguous
+     * segments (through the position index when it is enabled, otherwise
+     * with one O(n) pass) and the segments run as tasks of pool, which
+     * needs size() and parallel_for(first, last, fn, grain) like
+     * ThreadPool. The list must not be modified while they run.
+     * parallelForEach and parallelTransform re-key the hash index after
+     * writing, even when fn throws.
+     */
+    template <typename Pool, typename Fn>
+    void parallelForEach(Pool &pool, Fn fn)
+    {
+        DLL_OP(PARALLEL_FOR_EACH);
+        std::vector<Node *> bounds = splitPoints(segmentCount(length, pool.size()));
+        try
+        {
+            pool.parallel_for(0, int(bounds.size()) - 1, [&](int s) {
+                for (Node *curr = bounds[s]; curr != bounds[s + 1]; curr = nextOf(curr))
+                    fn(curr->data);
+            }, 1);
+        }
+        catch (...)
+        {
+            rebuildHashIndex();
+            throw;
+        }
+        rebuildHashIndex(); // fn may have changed any value in place
+    }
+
+    // Replace every element x with fn(x)
+    template <typename Pool, typename Fn>
+    void parallelTransform(Pool &pool, Fn fn)
+    {
+        DLL_OP(PARALLEL_TRANSFORM);
+        parallelForEach(pool, [&fn](T &value) { value = fn(value); });
+    }
+
+    // init op x0 op x1 op ...; op must be associative (segments are combined in order)
+    template <typename Pool, typename U, typename Op>
+    U parallelReduce(Pool &pool, U init, Op op)
+    {
+        DLL_OP(PARALLEL_REDUCE);
+        if (length == 0)
+            return init;
+        std::vector<Node *> bounds = splitPoints(segmentCount(length, pool.size()));
+        int parts = int(bounds.size()) - 1;
+        std::vector<U> partial(parts);
+        pool.parallel_for(0, parts, [&](int s) {
+            Node *curr = bounds[s];
+            U acc = curr->data;
+            for (curr = nextOf(curr); curr != bounds[s + 1]; curr = nextOf(curr))
+                acc = op(acc, curr->data);
+            partial[s] = acc;
+        }, 1);
+        for (int s = 0; s < parts; ++s)
+            init = op(init, partial[s]);
+        return init;
+    }
+
+    template <typename Pool, typename Pred>
+    int parallelCountIf(Pool &pool, Pred pred)
+    {
+        DLL_OP(PARALLEL_COUNT_IF);
+        std::vector<Node *> bounds = splitPoints(segmentCount(length, pool.size()));
+        int parts = int(bounds.size()) - 1;
+        std::vector<int> partial(parts, 0);
+        pool.parallel_for(0, parts, [&](int s) {
+            int count = 0;
+            for (Node *curr = bounds[s]; curr != bounds[s + 1]; curr = nextOf(curr))
+                count += pred(curr->data) ? 1 : 0;
+            partial[s] = count;
+        }, 1);
+        int total = 0;
+        for (int count : partial)
+            total += count;
+        return total;
+    }
+
+    /**
+     * Stable sort by relinking the existing nodes: bottom-up merge sort
+     * through one link direction, then a single pass that repairs the other.
+     * Allocates nothing and never copies or moves an element.
+     */
+    template <typename Compare = std::less<T>>
+    void sort(Compare comp = Compare())
+    {
+        DLL_OP(SORT);
+        if (length < 2)
+            return;
+        Node *Node::*fwd = reversed ? &Node::prev : &Node::next;
+        Node *Node::*back = reversed ? &Node::next : &Node::prev;
+        Node *first = firstNode();
+        endNode()->*back->*fwd = nullptr; // cut off the end sentinel
+        relinkSorted(sortRun(first, comp, fwd));
+    }
+
+    /**
+     * sort() with the segments sorted as tasks of pool and then merged
+     * pairwise, one parallel round per level. comp is shared by all tasks.
+     */
+    template <typename Pool, typename Compare = std::less<T>>
+    void parallelSort(Pool &pool, Compare comp = Compare())
+    {
+        DLL_OP(PARALLEL_SORT);
+        const int PARALLEL_THRESHOLD = 1 << 15;
+        if (length < PARALLEL_THRESHOLD || pool.size() < 2)
+        {
+            sort(comp);
+            return;
+        }
+        Node *Node::*fwd = reversed ? &Node::prev : &Node::next;
+        Node *Node::*back = reversed ? &Node::next : &Node::prev;
+        std::vector<Node *> runs = splitPoints(segmentCount(length, pool.size()));
+        runs.pop_back();
+        std::vector<Node *> lasts;
+        for (std::size_t s = 1; s < runs.size(); ++s)
+            lasts.push_back(runs[s]->*back);
+        lasts.push_back(endNode()->*back);
+        for (Node *last : lasts)
+            last->*fwd = nullptr;
+
+        pool.parallel_for(0, int(runs.size()), [&](int s) { runs[s] = sortRun(runs[s], comp, fwd); }, 1);
+        while (runs.size() > 1)
+        {
+            std::vector<Node *> merged((runs.size() + 1) / 2);
+            pool.parallel_for(0, int(merged.size()), [&](int m) {
+                merged[m] = 2 * m + 1 < int(runs.size()) ? mergeRuns(runs[2 * m], runs[2 * m + 1], comp, fwd) : runs[2 * m];
+            }, 1);
+            runs.swap(merged);
+        }
+        relinkSorted(runs[0]);
+    }
+
+    // Remove every element for which pred(element) is true; returns how many
+    template <typename Pred>
+    int eraseIf(Pred pred)
+    {
+        DLL_OP(ERASE_IF);
+        int removed = 0;
+        for (Node *curr = firstNode(); curr != endNode();)
+        {
+            Node *next = nextOf(curr);
+            if (pred(curr->data))
+            {
+                unlink(curr);
+                destroyNode(curr);
+                ++removed;
+            }
+            curr = next;
+        }
+        return removed;
+    }
+
+    /**
+     * Remove every element for which same(previous kept element, element) is
+     * true, so runs of equal neighbours shrink to their first element.
+     * Returns how many were removed.
+     */
+    template <typename BinaryPred = std::equal_to<T>>
+    int unique(BinaryPred same = BinaryPred())
+    {
+        DLL_OP(UNIQUE);
+        if (length < 2)
+            return 0;
+        int removed = 0;
+        Node *kept = firstNode();
+        for (Node *curr = nextOf(kept); curr != endNode();)
+        {
+            Node *next = nextOf(curr);
+            if (same(kept->data, curr->data))
+            {
+                unlink(curr);
+                destroyNode(curr);
+                ++removed;
+            }
+            else
+            {
+                kept = curr;
+            }
+            curr = next;
+        }
+        return removed;
+    }
+
+    /**
+     * Merge other (sorted by comp) into this list (sorted by comp) in
+     * O(n + m), relinking other's nodes and leaving it empty. Stable: of two
+     * equal elements, the one from this list comes first.
+     */
+    template <typename Compare = std::less<T>>
+    void merge(DoublyLinkedList &other, Compare comp = Compare())
+    {
+        DLL_OP(MERGE);
+        if (this == &other || other.length == 0)
+            return;
+        if (length == 0)
+        {
+            append(std::move(other));
+            return;
+        }
+        Node *Node::*fwd = reversed ? &Node::prev : &Node::next;
+        Node *Node::*back = reversed ? &Node::next : &Node::prev;
+        Node *first = firstNode();
+        Node *mine = endNode()->*back;
+        append(std::move(other));
+        Node *theirs = mine->*fwd;
+        mine->*fwd = nullptr;
+        endNode()->*back->*fwd = nullptr;
+        relinkSorted(mergeRuns(first, theirs, comp, fwd));
+    }
+
+    /**
+     * First element for which pred is false, given that pred is true for a
+     * prefix of the list and false for the rest (end() if none). Descends
+     * the position index in O(log n) when it is enabled, otherwise walks
+     * from the front.
+     */
+    template <typename Pred>
+    Iterator partitionPoint(Pred pred) const
+    {
+        DLL_OP(PARTITION_POINT);
+        if (!index)
+        {
+            Node *curr = firstNode();
+            while (curr != endNode() && pred(curr->data))
+                curr = nextOf(curr);
+            return Iterator(curr, reversed);
+        }
+        if (!reversed)
+        {
+            Node *found = index->firstWhere([&](const Node *node) { return !pred(node->data); });
+            return Iterator(found ? found : tail, false);
+        }
+        // Physically the list runs backwards: find the logically last node where pred holds
+        Node *found = index->firstWhere([&](const Node *node) { return pred(node->data); });
+        return Iterator(found ? found->prev : firstNode(), true);
+    }
+
+    friend void swap(DoublyLinkedList &a, DoublyLinkedList &b) noexcept
+    {
+        a.swap(b);
     }
 };
 #endif // __DOUBLY_LINKED_LIST_H__
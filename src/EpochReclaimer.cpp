@@ -0,0 +1,162 @@
+#include "EpochReclaimer.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    std::atomic<std::uint64_t> nextReclaimerId{1};
+
+    // Ids of the reclaimers still alive; only touched on construction,
+    // destruction and when a thread prunes its cache
+    std::mutex liveLock;
+    std::unordered_set<std::uint64_t> liveIds;
+
+    // Per-thread record of every reclaimer this thread used, by id. Ids are
+    // never reused, so an entry for a destroyed reclaimer is never hit again;
+    // it is only dead weight until the next prune.
+    const std::size_t MIN_PRUNE_SIZE = 16;
+    thread_local std::unordered_map<std::uint64_t, void *> known;
+    thread_local std::size_t pruneAt = MIN_PRUNE_SIZE;
+
+    void pruneKnown()
+    {
+        {
+            std::lock_guard<std::mutex> guard(liveLock);
+            for (auto it = known.begin(); it != known.end();)
+                it = liveIds.count(it->first) ? std::next(it) : known.erase(it);
+        }
+        // Prune again only once the cache doubled, so each insert pays O(1) amortized
+        pruneAt = std::max(MIN_PRUNE_SIZE, 2 * known.size());
+    }
+}
+
+EpochReclaimer::EpochReclaimer(Reclaim reclaimFn, void *reclaimOwner)
+    : id(nextReclaimerId.fetch_add(1)), reclaim(reclaimFn), owner(reclaimOwner)
+{
+    std::lock_guard<std::mutex> guard(liveLock);
+    liveIds.insert(id);
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+    {
+        std::lock_guard<std::mutex> guard(liveLock);
+        liveIds.erase(id);
+    }
+    reclaimAll();
+    Record *record = records.load();
+    while (record)
+    {
+        Record *next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+EpochReclaimer::Record *EpochReclaimer::local()
+{
+    // Ids are never reused, so a stale entry for a destroyed reclaimer is never hit again
+    thread_local std::uint64_t lastId = 0;
+    thread_local Record *lastRecord = nullptr;
+    if (lastId == id)
+        return lastRecord;
+
+    Record *record;
+    auto found = known.find(id);
+    if (found != known.end())
+    {
+        record = static_cast<Record *>(found->second);
+    }
+    else
+    {
+        if (known.size() >= pruneAt)
+            pruneKnown();
+        record = new Record();
+        Record *head = records.load();
+        do
+            record->next = head;
+        while (!records.compare_exchange_weak(head, record));
+        known.emplace(id, record);
+    }
+    lastId = id;
+    lastRecord = record;
+    return record;
+}
+
+bool EpochReclaimer::tryAdvance()
+{
+    std::uint64_t epoch = globalEpoch.load();
+    for (Record *r = records.load(); r; r = r->next)
+    {
+        std::uint64_t announced = r->epoch.load();
+        if (announced != 0 && announced != epoch)
+            return false; // someone is still working in an older epoch
+    }
+    return globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+void EpochReclaimer::flush(Record *record, int bucket)
+{
+    for (std::uint32_t handle : record->retired[bucket])
+        reclaim(owner, handle);
+    record->retired[bucket].clear();
+}
+
+void EpochReclaimer::collect(Record *record)
+{
+    // Anything retired two epochs ago can no longer be held by any Guard
+    std::uint64_t epoch = globalEpoch.load();
+    for (int b = 0; b < 3; ++b)
+    {
+        if (!record->retired[b].empty() && record->retiredEpoch[b] + 2 <= epoch)
+            flush(record, b);
+    }
+}
+
+EpochReclaimer::Guard::Guard(EpochReclaimer &reclaimer) : owner(reclaimer), record(reclaimer.local())
+{
+    if (record->depth++ == 0)
+        record->epoch.store(reclaimer.globalEpoch.load()); // seq_cst: visible before any shared read
+}
+
+EpochReclaimer::Guard::~Guard()
+{
+    if (--record->depth == 0)
+        record->epoch.store(0, std::memory_order_release);
+}
+
+void EpochReclaimer::retire(Guard &guard, std::uint32_t handle)
+{
+    Record *record = guard.record;
+    std::uint64_t epoch = globalEpoch.load();
+    int bucket = int(epoch % 3);
+    if (record->retiredEpoch[bucket] != epoch)
+    {
+        // The bucket holds handles from epoch - 3 or earlier: all safe by now
+        flush(record, bucket);
+        record->retiredEpoch[bucket] = epoch;
+    }
+    record->retired[bucket].push_back(handle);
+    if (++record->sinceScan >= SCAN_INTERVAL)
+    {
+        record->sinceScan = 0;
+        tryAdvance();
+        collect(record);
+    }
+}
+
+void EpochReclaimer::reclaimAll()
+{
+    for (Record *record = records.load(); record; record = record->next)
+    {
+        for (int b = 0; b < 3; ++b)
+            flush(record, b);
+    }
+}
+
+std::size_t EpochReclaimer::threadCacheSize()
+{
+    return known.size();
+}
@@ -0,0 +1,79 @@
+#ifndef __EPOCH_RECLAIMER_H__
+#define __EPOCH_RECLAIMER_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class EpochReclaimer
+ * @brief Epoch-based deferred reclamation for lock-free structures
+ *
+ * Threads wrap every access to the shared structure in a Guard. A handle
+ * passed to retire() is handed to the reclaim callback only once every
+ * thread that was inside a Guard at the time has left it, so nobody can
+ * still be reading the object behind it. Each thread registers a record the
+ * first time it uses a given reclaimer; records live until the reclaimer is
+ * destroyed, which also reclaims everything still pending. A thread's cache
+ * of its records drops entries for destroyed reclaimers as it grows, so it
+ * stays proportional to the reclaimers still alive.
+ */
+class EpochReclaimer
+{
+public:
+    typedef void (*Reclaim)(void *owner, std::uint32_t handle);
+
+private:
+    struct alignas(64) Record
+    {
+        std::atomic<std::uint64_t> epoch{0}; // announced epoch, 0 outside a Guard
+        Record *next = nullptr;
+        int depth = 0; // Guards may nest on one thread
+        std::vector<std::uint32_t> retired[3];
+        std::uint64_t retiredEpoch[3] = {0, 0, 0};
+        unsigned sinceScan = 0;
+    };
+
+    static const unsigned SCAN_INTERVAL = 64;
+
+    const std::uint64_t id; // distinguishes reclaimers in the per-thread record cache
+    std::atomic<std::uint64_t> globalEpoch{1};
+    std::atomic<Record *> records{nullptr};
+    Reclaim reclaim;
+    void *owner;
+
+    Record *local();
+    bool tryAdvance();
+    void flush(Record *record, int bucket);
+    void collect(Record *record);
+
+public:
+    EpochReclaimer(Reclaim reclaimFn, void *reclaimOwner);
+    ~EpochReclaimer();
+    EpochReclaimer(const EpochReclaimer &) = delete;
+    EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+    class Guard
+    {
+    private:
+        friend class EpochReclaimer;
+        EpochReclaimer &owner;
+        Record *record;
+
+    public:
+        explicit Guard(EpochReclaimer &reclaimer);
+        ~Guard();
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+    };
+
+    // handle is no longer reachable from the structure; reclaim it when safe
+    void retire(Guard &guard, std::uint32_t handle);
+    // Reclaim every pending handle now; only when no other thread is using the structure
+    void reclaimAll();
+    // Entries in the calling thread's record cache, live or not yet pruned
+    static std::size_t threadCacheSize();
+};
+
+#endif // __EPOCH_RECLAIMER_H__
@@ -0,0 +1,286 @@
+#ifndef __LIST_STATS_H__
+#define __LIST_STATS_H__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @class ListStats
+ * @brief Snapshot of the counters a list keeps in instrumentation mode
+ *
+ * Building with -DDLL_INSTRUMENT makes DoublyLinkedList count calls per
+ * operation, the nodes each index-based operation walks past and the nodes
+ * it allocates and frees. -DDLL_INSTRUMENT_LATENCY (which implies the first)
+ * also keeps a latency histogram per operation in timestamp-counter ticks.
+ * Without the flags nothing is recorded, the list carries no extra member
+ * and stats() returns an all-zero snapshot with enabled == false.
+ *
+ * The flags change the layout of the list, so every translation unit of a
+ * program must be built with the same ones.
+ */
+struct ListStats
+{
+    enum Operation
+    {
+        INSERT_AT_HEAD,
+        INSERT_AT_TAIL,
+        INSERT_AT,
+        DELETE_AT,
+        GET,
+        INDEX_OF,
+        CONTAINS,
+        INSERT, // insert/emplace at an Iterator
+        ERASE,  // erase at an Iterator
+        SPLICE, // splice, append, splitAt
+        REVERSE,
+        SORT,
+        TO_STRING,
+        CLEAR,
+        FIND_NODE,
+        COUNT_OF,
+        INDEX_OF_ANY,
+        CURSOR,
+        APPEND_RANGE,
+        ASSIGN,
+        APPEND_DELIMITED,
+        SAVE_BINARY,
+        LOAD_BINARY,
+        PARALLEL_FOR_EACH,
+        PARALLEL_TRANSFORM,
+        PARALLEL_REDUCE,
+        PARALLEL_COUNT_IF,
+        PARALLEL_SORT,
+        ERASE_IF,
+        UNIQUE,
+        MERGE,
+        PARTITION_POINT,
+        OPERATION_COUNT
+    };
+
+    /**
+     * Power-of-two buckets: bucket 0 counts zeros and bucket b > 0 counts
+     * values in [2^(b-1), 2^b). Percentiles report the bucket's upper bound.
+     */
+    struct Histogram
+    {
+        static const int BUCKETS = 48;
+        std::uint64_t buckets[BUCKETS] = {};
+        std::uint64_t count = 0;
+        std::uint64_t total = 0;
+        std::uint64_t max = 0;
+
+        void add(std::uint64_t value)
+        {
+            int b = value == 0 ? 0 : 64 - __builtin_clzll(value);
+            ++buckets[b < BUCKETS ? b : BUCKETS - 1];
+            ++count;
+            total += value;
+            if (value > max)
+                max = value;
+        }
+
+        double mean() const
+        {
+            return count ? double(total) / double(count) : 0.0;
+        }
+
+        // Smallest bucket bound that at least fraction p of the values stay under
+        std::uint64_t percentile(double p) const
+        {
+            std::uint64_t seen = 0;
+            for (int b = 0; b < BUCKETS; ++b)
+            {
+                seen += buckets[b];
+                if (count && double(seen) >= p * double(count))
+                    return b == 0 ? 0 : (std::uint64_t(1) << b) - 1;
+            }
+            return max;
+        }
+    };
+
+    bool enabled = false;
+    bool latencyEnabled = false;
+    std::uint64_t calls[OPERATION_COUNT] = {};
+    Histogram walks[OPERATION_COUNT]; // nodes walked by GET, INSERT_AT and DELETE_AT
+    Histogram ticks[OPERATION_COUNT]; // only with DLL_INSTRUMENT_LATENCY
+    std::uint64_t nodesAllocated = 0;
+    std::uint64_t nodesFreed = 0;
+
+    static const char *operationName(Operation op)
+    {
+        static const char *const NAMES[OPERATION_COUNT] = {
+            "insertAtHead", "insertAtTail", "insertAt", "deleteAt", "get", "indexOf", "contains",
+            "insert", "erase", "splice", "reverse", "sort", "toString", "clear", "findNode", "countOf",
+            "indexOfAny", "cursor", "appendRange", "assign", "appendDelimited", "saveBinary", "loadBinary",
+            "parallelForEach", "parallelTransform", "parallelReduce", "parallelCountIf", "parallelSort", "eraseIf",
+            "unique", "merge", "partitionPoint"};
+        return NAMES[op];
+    }
+
+    // One line per operation that was called, plus the allocation totals
+    std::string toString() const
+    {
+        if (!enabled)
+            return "instrumentation disabled (build with -DDLL_INSTRUMENT)\n";
+        std::string out;
+        char line[256];
+        for (int op = 0; op < OPERATION_COUNT; ++op)
+        {
+            if (!calls[op])
+                continue;
+            int n = std::snprintf(line, sizeof(line), "%-18s calls=%llu", operationName(Operation(op)),
+                                  (unsigned long long)calls[op]);
+            if (walks[op].count)
+                n += std::snprintf(line + n, sizeof(line) - n, " walk mean=%.1f p99<=%llu max=%llu", walks[op].mean(),
+                                   (unsigned long long)walks[op].percentile(0.99), (unsigned long long)walks[op].max);
+            if (ticks[op].count)
+                std::snprintf(line + n, sizeof(line) - n, " ticks mean=%.0f p99<=%llu", ticks[op].mean(),
+                              (unsigned long long)ticks[op].percentile(0.99));
+            out += line;
+            out += '\n';
+        }
+        std::snprintf(line, sizeof(line), "nodes allocated=%llu freed=%llu\n", (unsigned long long)nodesAllocated,
+                      (unsigned long long)nodesFreed);
+        out += line;
+        return out;
+    }
+
+    static std::uint64_t now()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::uint64_t(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+};
+
+#if defined(DLL_INSTRUMENT_LATENCY) && !defined(DLL_INSTRUMENT)
+#define DLL_INSTRUMENT
+#endif
+
+#ifdef DLL_INSTRUMENT
+
+/**
+ * @class ListStatsRecorder
+ * @brief The live counters behind ListStats, owned by one list
+ *
+ * Not synchronized: like the list itself it belongs to one thread at a time.
+ */
+class ListStatsRecorder
+{
+private:
+    ListStats stats;
+    ListStats::Operation current = ListStats::OPERATION_COUNT; // outermost operation in progress
+
+public:
+    ListStatsRecorder()
+    {
+        reset();
+    }
+
+    // Counters start from zero for every list, including copies and moved-to lists
+    ListStatsRecorder(const ListStatsRecorder &) : ListStatsRecorder() {}
+    ListStatsRecorder &operator=(const ListStatsRecorder &)
+    {
+        return *this;
+    }
+
+    void reset()
+    {
+        stats = ListStats();
+        stats.enabled = true;
+#ifdef DLL_INSTRUMENT_LATENCY
+        stats.latencyEnabled = true;
+#endif
+    }
+
+    const ListStats &snapshot() const
+    {
+        return stats;
+    }
+
+    void allocated()
+    {
+        ++stats.nodesAllocated;
+    }
+
+    void freed()
+    {
+        ++stats.nodesFreed;
+    }
+
+    // Charged to the outermost operation in progress
+    void walked(int nodes)
+    {
+        if (current != ListStats::OPERATION_COUNT)
+            stats.walks[current].add(std::uint64_t(nodes));
+    }
+
+    /**
+     * Counts one call for the lifetime of a scope. Operations nested inside
+     * another (indexOf inside contains, say) are counted too, but their
+     * walks and latency belong to the outer one.
+     */
+    class Scope
+    {
+    private:
+        ListStatsRecorder &recorder;
+        bool outermost;
+#ifdef DLL_INSTRUMENT_LATENCY
+        std::uint64_t start;
+#endif
+
+    public:
+        Scope(ListStatsRecorder &recorder, ListStats::Operation op)
+            : recorder(recorder), outermost(recorder.current == ListStats::OPERATION_COUNT)
+        {
+            ++recorder.stats.calls[op];
+            if (outermost)
+                recorder.current = op;
+#ifdef DLL_INSTRUMENT_LATENCY
+            start = ListStats::now();
+#endif
+        }
+
+        ~Scope()
+        {
+            if (!outermost)
+                return;
+#ifdef DLL_INSTRUMENT_LATENCY
+            recorder.stats.ticks[recorder.current].add(ListStats::now() - start);
+#endif
+            recorder.current = ListStats::OPERATION_COUNT;
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+};
+
+#define DLL_STATS_MEMBER mutable ListStatsRecorder statsRecorder;
+#define DLL_OP(op) DLL_OP_OF(*this, op)
+// For static members: count the call on the list being built
+#define DLL_OP_OF(list, op) ListStatsRecorder::Scope dllStatsScope((list).statsRecorder, ListStats::op)
+#define DLL_WALKED(nodes) statsRecorder.walked(nodes)
+#define DLL_ALLOCATED() statsRecorder.allocated()
+#define DLL_FREED() statsRecorder.freed()
+
+#else
+
+#define DLL_STATS_MEMBER
+#define DLL_OP(op) ((void)0)
+#define DLL_OP_OF(list, op) ((void)0)
+#define DLL_WALKED(nodes) ((void)0)
+#define DLL_ALLOCATED() ((void)0)
+#define DLL_FREED() ((void)0)
+
+#endif // DLL_INSTRUMENT
+
+#endif // __LIST_STATS_H__
@@ -0,0 +1,257 @@
+#include "LockFreeDeque.h"
+#include <new>
+
+template <typename T>
+LockFreeDeque<T>::LockFreeDeque()
+    : anchor(pack(Anchor{0, 0, STABLE})), freeList(0), fresh(1), reclaimer(&LockFreeDeque::releaseSlot, this)
+{
+    for (int k = 0; k < MAX_CHUNKS; ++k)
+        chunks[k].store(nullptr, std::memory_order_relaxed);
+}
+
+template <typename T>
+LockFreeDeque<T>::~LockFreeDeque()
+{
+    // Single-threaded now: finish a pending push, then destroy what is left
+    Anchor a = unpack(anchor.load());
+    if (a.status != STABLE)
+        stabilize(a);
+    for (std::uint32_t i = a.left; i != 0;)
+    {
+        std::uint32_t next = i == a.right ? 0 : slot(i).right.load();
+        slot(i).value()->~T();
+        i = next;
+    }
+    reclaimer.reclaimAll(); // releaseSlot needs the chunks, so run it before they go
+    for (int k = 0; k < MAX_CHUNKS; ++k)
+        delete[] chunks[k].load();
+}
+
+template <typename T>
+typename LockFreeDeque<T>::Slot &LockFreeDeque<T>::slot(std::uint32_t index) const
+{
+    std::uint32_t group = index / FIRST_CHUNK + 1;
+    int k = 31 - __builtin_clz(group);
+    std::uint32_t offset = index - FIRST_CHUNK * ((1u << k) - 1);
+    return chunks[k].load(std::memory_order_acquire)[offset];
+}
+
+template <typename T>
+std::uint32_t LockFreeDeque<T>::allocateSlot()
+{
+    // Reuse a released slot; the tag stops a stale top from winning the CAS
+    std::uint64_t top = freeList.load(std::memory_order_acquire);
+    while (std::uint32_t(top) != 0)
+    {
+        std::uint32_t index = std::uint32_t(top);
+        std::uint64_t next = slot(index).right.load(std::memory_order_relaxed);
+        std::uint64_t newTop = next | (((top >> 32) + 1) << 32);
+        if (freeList.compare_exchange_weak(top, newTop, std::memory_order_acquire))
+            return index;
+    }
+
+    std::uint32_t index = fresh.fetch_add(1, std::memory_order_relaxed);
+    if (index > MAX_INDEX)
+        throw std::bad_alloc();
+    std::uint32_t group = index / FIRST_CHUNK + 1;
+    int k = 31 - __builtin_clz(group);
+    if (!chunks[k].load(std::memory_order_acquire))
+    {
+        Slot *chunk = new Slot[std::size_t(FIRST_CHUNK) << k]();
+        Slot *expected = nullptr;
+        if (!chunks[k].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel))
+            delete[] chunk; // another thread installed it first
+    }
+    return index;
+}
+
+template <typename T>
+void LockFreeDeque<T>::releaseSlot(void *self, std::uint32_t index)
+{
+    LockFreeDeque *deque = static_cast<LockFreeDeque *>(self);
+    Slot &s = deque->slot(index);
+    std::uint64_t top = deque->freeList.load(std::memory_order_relaxed);
+    do
+        s.right.store(std::uint32_t(top), std::memory_order_relaxed);
+    while (!deque->freeList.compare_exchange_weak(top, index | (((top >> 32) + 1) << 32), std::memory_order_release));
+}
+
+template <typename T>
+void LockFreeDeque<T>::stabilize(const Anchor &a)
+{
+    if (a.status == RIGHT_PUSH)
+        stabilizeRight(a);
+    else
+        stabilizeLeft(a);
+}
+
+template <typename T>
+void LockFreeDeque<T>::stabilizeRight(const Anchor &a)
+{
+    // Point the old rightmost slot at the new one, then mark the anchor stable
+    std::uint64_t word = pack(a);
+    std::uint32_t prev = slot(a.right).left.load();
+    if (anchor.load() != word)
+        return;
+    std::uint32_t prevNext = slot(prev).right.load();
+    if (prevNext != a.right)
+    {
+        if (anchor.load() != word)
+            return;
+        if (!slot(prev).right.compare_exchange_strong(prevNext, a.right))
+            return;
+    }
+    anchor.compare_exchange_strong(word, pack(Anchor{a.left, a.right, STABLE}));
+}
+
+template <typename T>
+void LockFreeDeque<T>::stabilizeLeft(const Anchor &a)
+{
+    std::uint64_t word = pack(a);
+    std::uint32_t next = slot(a.left).right.load();
+    if (anchor.load() != word)
+        return;
+    std::uint32_t nextPrev = slot(next).left.load();
+    if (nextPrev != a.left)
+    {
+        if (anchor.load() != word)
+            return;
+        if (!slot(next).left.compare_exchange_strong(nextPrev, a.left))
+            return;
+    }
+    anchor.compare_exchange_strong(word, pack(Anchor{a.left, a.right, STABLE}));
+}
+
+template <typename T>
+void LockFreeDeque<T>::link(std::uint32_t index, bool front)
+{
+    EpochReclaimer::Guard guard(reclaimer);
+    Slot &s = slot(index);
+    while (true)
+    {
+        std::uint64_t word = anchor.load();
+        Anchor a = unpack(word);
+        if (a.right == 0)
+        {
+            s.left.store(0, std::memory_order_relaxed);
+            s.right.store(0, std::memory_order_relaxed);
+            if (anchor.compare_exchange_weak(word, pack(Anchor{index, index, STABLE})))
+                return;
+        }
+        else if (a.status == STABLE)
+        {
+            Anchor pushed = front ? Anchor{index, a.right, LEFT_PUSH} : Anchor{a.left, index, RIGHT_PUSH};
+            s.left.store(front ? 0 : a.right, std::memory_order_relaxed);
+            s.right.store(front ? a.left : 0, std::memory_order_relaxed);
+            if (anchor.compare_exchange_weak(word, pack(pushed)))
+            {
+                stabilize(pushed);
+                return;
+            }
+        }
+        else
+        {
+            stabilize(a);
+        }
+    }
+}
+
+template <typename T>
+bool LockFreeDeque<T>::pop(T &out, bool front)
+{
+    EpochReclaimer::Guard guard(reclaimer);
+    std::uint32_t taken;
+    while (true)
+    {
+        std::uint64_t word = anchor.load();
+        Anchor a = unpack(word);
+        if (a.right == 0)
+            return false;
+        if (a.left == a.right)
+        {
+            if (anchor.compare_exchange_weak(word, pack(Anchor{0, 0, STABLE})))
+            {
+                taken = a.left;
+                break;
+            }
+        }
+        else if (a.status == STABLE)
+        {
+            Anchor popped = front ? Anchor{slot(a.left).right.load(), a.right, STABLE}
+                                  : Anchor{a.left, slot(a.right).left.load(), STABLE};
+            if (anchor.compare_exchange_weak(word, pack(popped)))
+            {
+                taken = front ? a.left : a.right;
+                break;
+            }
+        }
+        else
+        {
+            stabilize(a);
+        }
+    }
+    // Only this thread can reach the value now; neighbours may still read the links
+    T *value = slot(taken).value();
+    out = std::move(*value);
+    value->~T();
+    reclaimer.retire(guard, taken);
+    return true;
+}
+
+template <typename T>
+void LockFreeDeque<T>::pushFront(const T &data)
+{
+    std::uint32_t index = allocateSlot();
+    new (slot(index).storage) T(data);
+    link(index, true);
+}
+
+template <typename T>
+void LockFreeDeque<T>::pushFront(T &&data)
+{
+    std::uint32_t index = allocateSlot();
+    new (slot(index).storage) T(std::move(data));
+    link(index, true);
+}
+
+template <typename T>
+void LockFreeDeque<T>::pushBack(const T &data)
+{
+    std::uint32_t index = allocateSlot();
+    new (slot(index).storage) T(data);
+    link(index, false);
+}
+
+template <typename T>
+void LockFreeDeque<T>::pushBack(T &&data)
+{
+    std::uint32_t index = allocateSlot();
+    new (slot(index).storage) T(std::move(data));
+    link(index, false);
+}
+
+template <typename T>
+bool LockFreeDeque<T>::popFront(T &out)
+{
+    return pop(out, true);
+}
+
+template <typename T>
+bool LockFreeDeque<T>::popBack(T &out)
+{
+    return pop(out, false);
+}
+
+template <typename T>
+bool LockFreeDeque<T>::empty() const
+{
+    return unpack(anchor.load()).right == 0;
+}
+
+// Explicit template instantiation for char, string, int, double, float, and Point
+template class LockFreeDeque<char>;
+template class LockFreeDeque<string>;
+template class LockFreeDeque<int>;
+template class LockFreeDeque<double>;
+template class LockFreeDeque<float>;
+template class LockFreeDeque<Point>;
@@ -0,0 +1,100 @@
+#ifndef __LOCK_FREE_DEQUE_H__
+#define __LOCK_FREE_DEQUE_H__
+
+#include "main.h"
+#include "EpochReclaimer.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class LockFreeDeque
+ * @brief Lock-free double-ended queue (Michael's CAS-based deque)
+ *
+ * Elements live in a doubly linked chain of slots. One 64-bit anchor word
+ * holds the leftmost slot, the rightmost slot and a status that says
+ * whether a push at either end still has to finish linking its neighbour;
+ * every operation completes such a pending push before starting its own,
+ * so no thread ever waits for another. Slots are addressed by 31-bit
+ * indices into an arena of chunks that grows but never shrinks, which is
+ * what lets both ends fit in the anchor. Popped slots go back to a
+ * lock-free free list through an EpochReclaimer, so a slot is never reused
+ * while another thread may still be reading it.
+ *
+ * Ends are front/left and back/right. There is no size(): any count would
+ * be stale the moment it was read.
+ */
+template <typename T>
+class LockFreeDeque
+{
+private:
+    struct Slot
+    {
+        std::atomic<std::uint32_t> left;
+        std::atomic<std::uint32_t> right; // also the free-list link
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() { return reinterpret_cast<T *>(storage); }
+    };
+
+    enum Status : std::uint64_t
+    {
+        STABLE = 0,
+        RIGHT_PUSH = 1,
+        LEFT_PUSH = 2
+    };
+
+    struct Anchor
+    {
+        std::uint32_t left;
+        std::uint32_t right;
+        Status status;
+    };
+
+    // Chunk k holds FIRST_CHUNK << k slots; index 0 means "no slot"
+    static const std::uint32_t FIRST_CHUNK = 1024;
+    static const int MAX_CHUNKS = 22;
+    static const std::uint32_t MAX_INDEX = (1u << 31) - 1;
+
+    std::atomic<Slot *> chunks[MAX_CHUNKS];
+    std::atomic<std::uint64_t> anchor;
+    std::atomic<std::uint64_t> freeList; // top index in the low half, ABA tag in the high half
+    std::atomic<std::uint32_t> fresh;    // first never-used index
+    EpochReclaimer reclaimer;
+
+    static std::uint64_t pack(const Anchor &a)
+    {
+        return (std::uint64_t(a.left) << 33) | (std::uint64_t(a.right) << 2) | a.status;
+    }
+
+    static Anchor unpack(std::uint64_t word)
+    {
+        return Anchor{std::uint32_t(word >> 33), std::uint32_t((word >> 2) & MAX_INDEX), Status(word & 3)};
+    }
+
+    Slot &slot(std::uint32_t index) const;
+    std::uint32_t allocateSlot();
+    static void releaseSlot(void *self, std::uint32_t index);
+
+    void stabilize(const Anchor &a);
+    void stabilizeLeft(const Anchor &a);
+    void stabilizeRight(const Anchor &a);
+    void link(std::uint32_t index, bool front);
+    bool pop(T &out, bool front);
+
+public:
+    LockFreeDeque();
+    ~LockFreeDeque();
+    LockFreeDeque(const LockFreeDeque &) = delete;
+    LockFreeDeque &operator=(const LockFreeDeque &) = delete;
+
+    void pushFront(const T &data);
+    void pushFront(T &&data);
+    void pushBack(const T &data);
+    void pushBack(T &&data);
+    // Move the end element into out; false if the deque was empty
+    bool popFront(T &out);
+    bool popBack(T &out);
+    bool empty() const;
+};
+
+#endif // __LOCK_FREE_DEQUE_H__
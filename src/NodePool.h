@@ -0,0 +1,232 @@
+#ifndef __NODE_POOL_H__
+#define __NODE_POOL_H__
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @class NodePool
+ * @brief Slab allocator for list nodes of one type
+ *
+ * Memory is taken from the system in pages of growing size. Freed slots go
+ * onto an intrusive free list and are handed out again before any new page
+ * is requested. Pages are only returned when the pool itself is destroyed.
+ * The pool only manages raw storage; constructing and destroying the node
+ * objects is the caller's job.
+ */
+template <typename Node>
+class NodePool
+{
+private:
+    union Slot
+    {
+        Slot *nextFree;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    static const std::size_t FIRST_PAGE_SLOTS = 16;
+    static const std::size_t MAX_PAGE_SLOTS = 4096;
+
+    std::vector<Slot *> pages;
+    Slot *freeList = nullptr;
+    Slot *freeTail = nullptr; // lets absorb() concatenate free lists in O(1)
+    std::size_t freeCount = 0;
+    Slot *bump = nullptr;    // next untouched slot of the newest page
+    Slot *bumpEnd = nullptr; // one past the last slot of the newest page
+    std::size_t nextPageSlots = FIRST_PAGE_SLOTS;
+
+    void addPage(std::size_t slots)
+    {
+        // Slots left in the current page must not be lost when we switch pages
+        while (bump != bumpEnd)
+            deallocate(bump++);
+        pages.reserve(pages.size() + 1);
+        Slot *page = static_cast<Slot *>(::operator new(slots * sizeof(Slot)));
+        pages.push_back(page);
+        bump = page;
+        bumpEnd = page + slots;
+    }
+
+public:
+    NodePool() = default;
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    ~NodePool()
+    {
+        for (Slot *page : pages)
+            ::operator delete(page);
+    }
+
+    void *allocate()
+    {
+        if (freeList)
+        {
+            Slot *slot = freeList;
+            freeList = slot->nextFree;
+            if (!freeList)
+                freeTail = nullptr;
+            --freeCount;
+            return slot;
+        }
+        if (bump == bumpEnd)
+        {
+            addPage(nextPageSlots);
+            if (nextPageSlots < MAX_PAGE_SLOTS)
+                nextPageSlots *= 2;
+        }
+        return bump++;
+    }
+
+    void deallocate(void *p)
+    {
+        Slot *slot = static_cast<Slot *>(p);
+        slot->nextFree = freeList;
+        if (!freeList)
+            freeTail = slot;
+        freeList = slot;
+        ++freeCount;
+    }
+
+    // Make sure the next n allocations are served without another page request
+    void reserve(std::size_t n)
+    {
+        std::size_t available = freeCount + static_cast<std::size_t>(bumpEnd - bump);
+        if (available < n)
+            addPage(n - available);
+    }
+
+    std::size_t pageCount() const
+    {
+        return pages.size();
+    }
+
+    /**
+     * Take over all pages and free slots of other. The untouched rest of
+     * other's newest page is dropped rather than walked; it is still freed
+     * with the pages.
+     */
+    void absorb(NodePool &other)
+    {
+        pages.insert(pages.end(), other.pages.begin(), other.pages.end());
+        other.pages.clear();
+        if (other.freeList)
+        {
+            other.freeTail->nextFree = freeList;
+            if (!freeList)
+                freeTail = other.freeTail;
+            freeList = other.freeList;
+            freeCount += other.freeCount;
+        }
+        other.freeList = other.freeTail = nullptr;
+        other.freeCount = 0;
+        other.bump = other.bumpEnd = nullptr;
+    }
+
+    void swap(NodePool &other) noexcept
+    {
+        pages.swap(other.pages);
+        std::swap(freeList, other.freeList);
+        std::swap(freeTail, other.freeTail);
+        std::swap(freeCount, other.freeCount);
+        std::swap(bump, other.bump);
+        std::swap(bumpEnd, other.bumpEnd);
+        std::swap(nextPageSlots, other.nextPageSlots);
+    }
+};
+
+/**
+ * @class SharedNodePool
+ * @brief NodePool that several lists can share once nodes move between them
+ *
+ * join() merges two pools: the pages of one move into the other, which then
+ * forwards to it, so a node stays valid as long as any list that may hold it
+ * is alive. Forwarding chains are kept short by union by rank and path
+ * compression, so allocation stays amortized O(1) however many splices
+ * joined the pools. Lists sharing a pool must not be modified concurrently.
+ */
+template <typename Node>
+class SharedNodePool
+{
+private:
+    NodePool<Node> pool;
+    std::shared_ptr<SharedNodePool> parent; // set once this pool was merged into another
+    int height = 0;                         // upper bound on the forwarding depth below a root
+
+    SharedNodePool *root()
+    {
+        // Nearly always zero or one hop; only longer chains pay for compression
+        if (!parent)
+            return this;
+        if (!parent->parent)
+            return parent.get();
+        parent = findRoot(parent);
+        return parent.get();
+    }
+
+    // Root of node's forwarding chain; every pool on the way is re-pointed straight at it
+    static std::shared_ptr<SharedNodePool> findRoot(std::shared_ptr<SharedNodePool> node)
+    {
+        std::shared_ptr<SharedNodePool> top = node;
+        while (top->parent)
+            top = top->parent;
+        while (node != top)
+        {
+            // node keeps the pool alive while it is re-pointed; dropping it may free an emptied pool
+            std::shared_ptr<SharedNodePool> next = std::move(node->parent);
+            node->parent = top;
+            node = std::move(next);
+        }
+        return top;
+    }
+
+public:
+    void *allocate()
+    {
+        return root()->pool.allocate();
+    }
+
+    void deallocate(void *p)
+    {
+        root()->pool.deallocate(p);
+    }
+
+    void reserve(std::size_t n)
+    {
+        root()->pool.reserve(n);
+    }
+
+    // True once this pool forwards to the pool it was merged into
+    bool isMerged() const
+    {
+        return parent != nullptr;
+    }
+
+    // Make a and b allocate from (and keep alive) the same set of pages
+    static void join(std::shared_ptr<SharedNodePool> &a, std::shared_ptr<SharedNodePool> &b)
+    {
+        if (!b)
+            return; // b has no nodes, so nothing can move out of it
+        if (!a)
+        {
+            a = b;
+            return;
+        }
+        std::shared_ptr<SharedNodePool> rootA = findRoot(a);
+        std::shared_ptr<SharedNodePool> rootB = findRoot(b);
+        if (rootA == rootB)
+            return;
+        // Union by rank: the shallower tree goes under the deeper one
+        if (rootA->height < rootB->height)
+            rootA.swap(rootB);
+        rootA->pool.absorb(rootB->pool);
+        rootB->parent = rootA;
+        if (rootA->height == rootB->height)
+            ++rootA->height;
+    }
+};
+
+#endif // __NODE_POOL_H__
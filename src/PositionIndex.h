@@ -0,0 +1,309 @@
+#ifndef __POSITION_INDEX_H__
+#define __POSITION_INDEX_H__
+
+#include "NodePool.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class PositionIndex
+ * @brief Order-statistic treap that maps positions to list nodes
+ *
+ * Entries are kept in list order (an implicit-key treap): each entry stores
+ * the size of its subtree, so the entry at position i and the position of a
+ * given entry are both found in O(log n) expected time. Entries know their
+ * parent, which lets the list insert next to or erase a node it already holds
+ * without searching by position first.
+ */
+template <typename Payload>
+class PositionIndex
+{
+public:
+    struct Entry
+    {
+        Payload *payload;
+        Entry *left;
+        Entry *right;
+        Entry *parent;
+        int size;
+        std::uint32_t priority;
+    };
+
+private:
+    Entry *root = nullptr;
+    NodePool<Entry> pool;
+    std::uint32_t seed = 0x9E3779B9u;
+
+    static int sizeOf(const Entry *e)
+    {
+        return e ? e->size : 0;
+    }
+
+    static void update(Entry *e)
+    {
+        e->size = 1 + sizeOf(e->left) + sizeOf(e->right);
+    }
+
+    std::uint32_t nextPriority()
+    {
+        // xorshift32 is plenty for treap balancing
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    Entry *makeEntry(Payload *payload)
+    {
+        Entry *e = static_cast<Entry *>(pool.allocate());
+        *e = Entry{payload, nullptr, nullptr, nullptr, 1, nextPriority()};
+        return e;
+    }
+
+    void replaceChild(Entry *parent, Entry *oldChild, Entry *newChild)
+    {
+        if (!parent)
+            root = newChild;
+        else if (parent->left == oldChild)
+            parent->left = newChild;
+        else
+            parent->right = newChild;
+        if (newChild)
+            newChild->parent = parent;
+    }
+
+    // Lift e above its parent, keeping in-order sequence and sizes intact
+    void rotateUp(Entry *e)
+    {
+        Entry *p = e->parent;
+        replaceChild(p->parent, p, e);
+        if (p->left == e)
+        {
+            p->left = e->right;
+            if (e->right)
+                e->right->parent = p;
+            e->right = p;
+        }
+        else
+        {
+            p->right = e->left;
+            if (e->left)
+                e->left->parent = p;
+            e->left = p;
+        }
+        p->parent = e;
+        update(p);
+        update(e);
+    }
+
+    void attach(Entry *e, Entry *parent, bool asLeft)
+    {
+        e->parent = parent;
+        if (!parent)
+            root = e;
+        else if (asLeft)
+            parent->left = e;
+        else
+            parent->right = e;
+        for (Entry *p = parent; p; p = p->parent)
+            ++p->size;
+        while (e->parent && e->parent->priority < e->priority)
+            rotateUp(e);
+    }
+
+    void freeAll(Entry *e)
+    {
+        // Iterative post-order so deep trees cannot overflow the stack
+        std::vector<Entry *> stack;
+        if (e)
+            stack.push_back(e);
+        while (!stack.empty())
+        {
+            Entry *top = stack.back();
+            stack.pop_back();
+            if (top->left)
+                stack.push_back(top->left);
+            if (top->right)
+                stack.push_back(top->right);
+            pool.deallocate(top);
+        }
+    }
+
+public:
+    PositionIndex() = default;
+    PositionIndex(const PositionIndex &) = delete;
+    PositionIndex &operator=(const PositionIndex &) = delete;
+
+    int size() const
+    {
+        return sizeOf(root);
+    }
+
+    // depth, when given, receives the number of entries stepped down past
+    Payload *at(int pos, int *depth = nullptr) const
+    {
+        Entry *e = root;
+        for (int d = 0; e; ++d)
+        {
+            if (depth)
+                *depth = d;
+            int leftSize = sizeOf(e->left);
+            if (pos < leftSize)
+            {
+                e = e->left;
+            }
+            else if (pos == leftSize)
+            {
+                return e->payload;
+            }
+            else
+            {
+                pos -= leftSize + 1;
+                e = e->right;
+            }
+        }
+        return nullptr;
+    }
+
+    int rankOf(const Entry *e) const
+    {
+        int rank = sizeOf(e->left);
+        for (; e->parent; e = e->parent)
+        {
+            if (e->parent->right == e)
+                rank += sizeOf(e->parent->left) + 1;
+        }
+        return rank;
+    }
+
+    /**
+     * First payload in order for which pred is true, or nullptr. pred must be
+     * false for a prefix of the entries and true for the rest; this is a
+     * single root-to-leaf descent.
+     */
+    template <typename Pred>
+    Payload *firstWhere(Pred pred) const
+    {
+        Entry *best = nullptr;
+        for (Entry *e = root; e;)
+        {
+            if (pred(e->payload))
+            {
+                best = e;
+                e = e->left;
+            }
+            else
+            {
+                e = e->right;
+            }
+        }
+        return best ? best->payload : nullptr;
+    }
+
+    // Insert a new entry just before pos (nullptr appends at the end)
+    Entry *insertBefore(Entry *pos, Payload *payload)
+    {
+        Entry *e = makeEntry(payload);
+        if (!pos)
+        {
+            Entry *last = root;
+            while (last && last->right)
+                last = last->right;
+            attach(e, last, false);
+        }
+        else if (!pos->left)
+        {
+            attach(e, pos, true);
+        }
+        else
+        {
+            Entry *pred = pos->left;
+            while (pred->right)
+                pred = pred->right;
+            attach(e, pred, false);
+        }
+        return e;
+    }
+
+    void erase(Entry *e)
+    {
+        // Sink e to a leaf, always promoting the child with higher priority
+        while (e->left || e->right)
+        {
+            Entry *child;
+            if (!e->left)
+                child = e->right;
+            else if (!e->right)
+                child = e->left;
+            else
+                child = e->left->priority > e->right->priority ? e->left : e->right;
+            rotateUp(child);
+        }
+        replaceChild(e->parent, e, nullptr);
+        for (Entry *p = e->parent; p; p = p->parent)
+            --p->size;
+        pool.deallocate(e);
+    }
+
+    void clear()
+    {
+        freeAll(root);
+        root = nullptr;
+    }
+
+    /**
+     * Rebuild from scratch in O(n). next(p) must return the payload after p
+     * and entryOf(p) receives the slot that should point at p's entry.
+     */
+    template <typename Next, typename EntrySlot>
+    void build(Payload *first, Payload *last, Next next, EntrySlot entryOf)
+    {
+        clear();
+        // Cartesian tree construction: the right spine lives on a stack
+        std::vector<Entry *> spine;
+        for (Payload *p = first; p != last; p = next(p))
+        {
+            Entry *e = makeEntry(p);
+            entryOf(p) = e;
+            Entry *lastPopped = nullptr;
+            while (!spine.empty() && spine.back()->priority < e->priority)
+            {
+                lastPopped = spine.back();
+                spine.pop_back();
+            }
+            e->left = lastPopped;
+            if (lastPopped)
+                lastPopped->parent = e;
+            if (!spine.empty())
+            {
+                spine.back()->right = e;
+                e->parent = spine.back();
+            }
+            spine.push_back(e);
+        }
+        root = spine.empty() ? nullptr : spine.front();
+
+        // Fix sizes bottom-up with an explicit post-order walk
+        std::vector<Entry *> order;
+        if (root)
+            order.push_back(root);
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (order[i]->left)
+                order.push_back(order[i]->left);
+            if (order[i]->right)
+                order.push_back(order[i]->right);
+        }
+        for (std::size_t i = order.size(); i-- > 0;)
+            update(order[i]);
+    }
+
+    void swap(PositionIndex &other) noexcept
+    {
+        std::swap(root, other.root);
+        pool.swap(other.pool);
+        std::swap(seed, other.seed);
+    }
+};
+
+#endif // __POSITION_INDEX_H__
@@ -0,0 +1,271 @@
+#include "SimdSearch.h"
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#define SIMD_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+#ifdef SIMD_SEARCH_X86
+namespace
+{
+    // Each Ops struct compares one vector of lanes and returns one mask bit per lane
+
+    struct Sse2Int
+    {
+        typedef int Scalar;
+        typedef __m128i Vec;
+        static const int LANES = 4;
+        static Vec splat(int v) { return _mm_set1_epi32(v); }
+        static unsigned equal(const int *p, Vec needle)
+        {
+            __m128i cmp = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), needle);
+            return unsigned(_mm_movemask_ps(_mm_castsi128_ps(cmp)));
+        }
+    };
+
+    struct Sse2Float
+    {
+        typedef float Scalar;
+        typedef __m128 Vec;
+        static const int LANES = 4;
+        static Vec splat(float v) { return _mm_set1_ps(v); }
+        static unsigned equal(const float *p, Vec needle)
+        {
+            return unsigned(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p), needle)));
+        }
+    };
+
+    struct Sse2Double
+    {
+        typedef double Scalar;
+        typedef __m128d Vec;
+        static const int LANES = 2;
+        static Vec splat(double v) { return _mm_set1_pd(v); }
+        static unsigned equal(const double *p, Vec needle)
+        {
+            return unsigned(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(p), needle)));
+        }
+    };
+
+    struct Sse2Char
+    {
+        typedef char Scalar;
+        typedef __m128i Vec;
+        static const int LANES = 16;
+        static Vec splat(char v) { return _mm_set1_epi8(v); }
+        static unsigned equal(const char *p, Vec needle)
+        {
+            __m128i cmp = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), needle);
+            return unsigned(_mm_movemask_epi8(cmp));
+        }
+    };
+
+    struct Avx2Int
+    {
+        typedef int Scalar;
+        typedef __m256i Vec;
+        static const int LANES = 8;
+        __attribute__((target("avx2"))) static Vec splat(int v) { return _mm256_set1_epi32(v); }
+        __attribute__((target("avx2"))) static unsigned equal(const int *p, Vec needle)
+        {
+            __m256i cmp = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), needle);
+            return unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(cmp)));
+        }
+    };
+
+    struct Avx2Float
+    {
+        typedef float Scalar;
+        typedef __m256 Vec;
+        static const int LANES = 8;
+        __attribute__((target("avx2"))) static Vec splat(float v) { return _mm256_set1_ps(v); }
+        __attribute__((target("avx2"))) static unsigned equal(const float *p, Vec needle)
+        {
+            return unsigned(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p), needle, _CMP_EQ_OQ)));
+        }
+    };
+
+    struct Avx2Double
+    {
+        typedef double Scalar;
+        typedef __m256d Vec;
+        static const int LANES = 4;
+        __attribute__((target("avx2"))) static Vec splat(double v) { return _mm256_set1_pd(v); }
+        __attribute__((target("avx2"))) static unsigned equal(const double *p, Vec needle)
+        {
+            return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(p), needle, _CMP_EQ_OQ)));
+        }
+    };
+
+    struct Avx2Char
+    {
+        typedef char Scalar;
+        typedef __m256i Vec;
+        static const int LANES = 32;
+        __attribute__((target("avx2"))) static Vec splat(char v) { return _mm256_set1_epi8(v); }
+        __attribute__((target("avx2"))) static unsigned equal(const char *p, Vec needle)
+        {
+            __m256i cmp = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), needle);
+            return unsigned(_mm256_movemask_epi8(cmp));
+        }
+    };
+
+    // The generic kernels exist twice so the AVX2 copies can carry the target attribute
+
+    template <typename Ops>
+    int findFirstSse2(const typename Ops::Scalar *data, int n, typename Ops::Scalar value)
+    {
+        typename Ops::Vec needle = Ops::splat(value);
+        int i = 0;
+        for (; i + Ops::LANES <= n; i += Ops::LANES)
+        {
+            unsigned mask = Ops::equal(data + i, needle);
+            if (mask)
+                return i + __builtin_ctz(mask);
+        }
+        int rest = SimdSearch::findFirst<typename Ops::Scalar>(data + i, n - i, value);
+        return rest < 0 ? -1 : i + rest;
+    }
+
+    template <typename Ops>
+    __attribute__((target("avx2"))) int findFirstAvx2(const typename Ops::Scalar *data, int n, typename Ops::Scalar value)
+    {
+        typename Ops::Vec needle = Ops::splat(value);
+        int i = 0;
+        for (; i + Ops::LANES <= n; i += Ops::LANES)
+        {
+            unsigned mask = Ops::equal(data + i, needle);
+            if (mask)
+                return i + __builtin_ctz(mask);
+        }
+        int rest = SimdSearch::findFirst<typename Ops::Scalar>(data + i, n - i, value);
+        return rest < 0 ? -1 : i + rest;
+    }
+
+    template <typename Ops>
+    int countSse2(const typename Ops::Scalar *data, int n, typename Ops::Scalar value)
+    {
+        typename Ops::Vec needle = Ops::splat(value);
+        int total = 0;
+        int i = 0;
+        for (; i + Ops::LANES <= n; i += Ops::LANES)
+            total += __builtin_popcount(Ops::equal(data + i, needle));
+        return total + SimdSearch::count<typename Ops::Scalar>(data + i, n - i, value);
+    }
+
+    template <typename Ops>
+    __attribute__((target("avx2"))) int countAvx2(const typename Ops::Scalar *data, int n, typename Ops::Scalar value)
+    {
+        typename Ops::Vec needle = Ops::splat(value);
+        int total = 0;
+        int i = 0;
+        for (; i + Ops::LANES <= n; i += Ops::LANES)
+            total += __builtin_popcount(Ops::equal(data + i, needle));
+        return total + SimdSearch::count<typename Ops::Scalar>(data + i, n - i, value);
+    }
+
+    // Small needle sets (the common membership case) are compared lane-parallel
+    const int MAX_VECTOR_NEEDLES = 8;
+
+    template <typename Ops>
+    int findFirstAnySse2(const typename Ops::Scalar *data, int n, const typename Ops::Scalar *values, int m)
+    {
+        if (m > MAX_VECTOR_NEEDLES)
+            return SimdSearch::findFirstAny<typename Ops::Scalar>(data, n, values, m);
+        typename Ops::Vec needles[MAX_VECTOR_NEEDLES];
+        for (int j = 0; j < m; ++j)
+            needles[j] = Ops::splat(values[j]);
+        int i = 0;
+        for (; i + Ops::LANES <= n; i += Ops::LANES)
+        {
+            unsigned mask = 0;
+            for (int j = 0; j < m; ++j)
+                mask |= Ops::equal(data + i, needles[j]);
+            if (mask)
+                return i + __builtin_ctz(mask);
+        }
+        int rest = SimdSearch::findFirstAny<typename Ops::Scalar>(data + i, n - i, values, m);
+        return rest < 0 ? -1 : i + rest;
+    }
+
+    template <typename Ops>
+    __attribute__((target("avx2"))) int findFirstAnyAvx2(const typename Ops::Scalar *data, int n, const typename Ops::Scalar *values, int m)
+    {
+        if (m > MAX_VECTOR_NEEDLES)
+            return SimdSearch::findFirstAny<typename Ops::Scalar>(data, n, values, m);
+        typename Ops::Vec needles[MAX_VECTOR_NEEDLES];
+        for (int j = 0; j < m; ++j)
+            needles[j] = Ops::splat(values[j]);
+        int i = 0;
+        for (; i + Ops::LANES <= n; i += Ops::LANES)
+        {
+            unsigned mask = 0;
+            for (int j = 0; j < m; ++j)
+                mask |= Ops::equal(data + i, needles[j]);
+            if (mask)
+                return i + __builtin_ctz(mask);
+        }
+        int rest = SimdSearch::findFirstAny<typename Ops::Scalar>(data + i, n - i, values, m);
+        return rest < 0 ? -1 : i + rest;
+    }
+
+    bool cpuHasAvx2()
+    {
+        static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+        return hasAvx2;
+    }
+}
+
+#define SIMD_SEARCH_DISPATCH(Type, Suffix)                                                                   \
+    int SimdSearch::findFirst(const Type *data, int n, const Type &value)                                    \
+    {                                                                                                        \
+        return cpuHasAvx2() ? findFirstAvx2<Avx2##Suffix>(data, n, value)                                    \
+                            : findFirstSse2<Sse2##Suffix>(data, n, value);                                   \
+    }                                                                                                        \
+    int SimdSearch::count(const Type *data, int n, const Type &value)                                        \
+    {                                                                                                        \
+        return cpuHasAvx2() ? countAvx2<Avx2##Suffix>(data, n, value) : countSse2<Sse2##Suffix>(data, n, value); \
+    }                                                                                                        \
+    int SimdSearch::findFirstAny(const Type *data, int n, const Type *values, int m)                         \
+    {                                                                                                        \
+        return cpuHasAvx2() ? findFirstAnyAvx2<Avx2##Suffix>(data, n, values, m)                             \
+                            : findFirstAnySse2<Sse2##Suffix>(data, n, values, m);                            \
+    }
+
+SIMD_SEARCH_DISPATCH(int, Int)
+SIMD_SEARCH_DISPATCH(float, Float)
+SIMD_SEARCH_DISPATCH(double, Double)
+SIMD_SEARCH_DISPATCH(char, Char)
+
+const char *SimdSearch::isa()
+{
+    return cpuHasAvx2() ? "avx2" : "sse2";
+}
+
+#else // no x86 vector unit: every overload uses the scalar loop
+
+#define SIMD_SEARCH_DISPATCH(Type, Suffix)                                           \
+    int SimdSearch::findFirst(const Type *data, int n, const Type &value)            \
+    {                                                                                \
+        return findFirst<Type>(data, n, value);                                      \
+    }                                                                                \
+    int SimdSearch::count(const Type *data, int n, const Type &value)                \
+    {                                                                                \
+        return count<Type>(data, n, value);                                          \
+    }                                                                                \
+    int SimdSearch::findFirstAny(const Type *data, int n, const Type *values, int m) \
+    {                                                                                \
+        return findFirstAny<Type>(data, n, values, m);                               \
+    }
+
+SIMD_SEARCH_DISPATCH(int, Int)
+SIMD_SEARCH_DISPATCH(float, Float)
+SIMD_SEARCH_DISPATCH(double, Double)
+SIMD_SEARCH_DISPATCH(char, Char)
+
+const char *SimdSearch::isa()
+{
+    return "scalar";
+}
+
+#endif // SIMD_SEARCH_X86
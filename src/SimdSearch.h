@@ -0,0 +1,75 @@
+#ifndef __SIMD_SEARCH_H__
+#define __SIMD_SEARCH_H__
+
+/**
+ * @class SimdSearch
+ * @brief Equality search over contiguous arrays
+ *
+ * int, float, double and char get vectorized kernels (AVX2 when the CPU has
+ * it, SSE2 otherwise, picked once at runtime). Every other type falls back to
+ * a plain loop with operator==. Floating point follows operator== exactly:
+ * NaN never matches and 0.0 matches -0.0.
+ */
+class SimdSearch
+{
+public:
+    // Position of the first element equal to value, or -1
+    template <typename T>
+    static int findFirst(const T *data, int n, const T &value)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            if (data[i] == value)
+                return i;
+        }
+        return -1;
+    }
+
+    // Number of elements equal to value
+    template <typename T>
+    static int count(const T *data, int n, const T &value)
+    {
+        int total = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            if (data[i] == value)
+                ++total;
+        }
+        return total;
+    }
+
+    // Position of the first element equal to any of values[0..m), or -1
+    template <typename T>
+    static int findFirstAny(const T *data, int n, const T *values, int m)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            for (int j = 0; j < m; ++j)
+            {
+                if (data[i] == values[j])
+                    return i;
+            }
+        }
+        return -1;
+    }
+
+    static int findFirst(const int *data, int n, const int &value);
+    static int findFirst(const float *data, int n, const float &value);
+    static int findFirst(const double *data, int n, const double &value);
+    static int findFirst(const char *data, int n, const char &value);
+
+    static int count(const int *data, int n, const int &value);
+    static int count(const float *data, int n, const float &value);
+    static int count(const double *data, int n, const double &value);
+    static int count(const char *data, int n, const char &value);
+
+    static int findFirstAny(const int *data, int n, const int *values, int m);
+    static int findFirstAny(const float *data, int n, const float *values, int m);
+    static int findFirstAny(const double *data, int n, const double *values, int m);
+    static int findFirstAny(const char *data, int n, const char *values, int m);
+
+    // Name of the kernel set chosen for this CPU ("avx2", "sse2" or "scalar")
+    static const char *isa();
+};
+
+#endif // __SIMD_SEARCH_H__
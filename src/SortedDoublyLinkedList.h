@@ -0,0 +1,169 @@
+#ifndef __SORTED_DOUBLY_LINKED_LIST_H__
+#define __SORTED_DOUBLY_LINKED_LIST_H__
+
+#include "DoublyLinkedList.h"
+#include <functional>
+
+/**
+ * @class SortedDoublyLinkedList
+ * @brief DoublyLinkedList that keeps its elements ordered by Compare
+ *
+ * Header-only because Compare is open-ended. By default the underlying list
+ * keeps its position index enabled: on a sorted list that treap is also a
+ * search tree over the values, so lowerBound, upperBound and insert are
+ * O(log n) instead of a walk. With indexed = false the list is leaner and
+ * every search is a single walk from the front.
+ *
+ * Elements equal under Compare keep their insertion order. Writing through
+ * an Iterator must not change an element's position in the order.
+ */
+template <typename T, typename Compare = std::less<T>>
+class SortedDoublyLinkedList
+{
+public:
+    typedef typename DoublyLinkedList<T>::Iterator Iterator;
+
+private:
+    DoublyLinkedList<T> list;
+    Compare comp;
+
+public:
+    explicit SortedDoublyLinkedList(Compare comp = Compare(), bool indexed = true) : comp(comp)
+    {
+        if (indexed)
+            list.enableIndex();
+    }
+
+    // Insert after every element equal to value; returns its position
+    Iterator insert(const T &value)
+    {
+        Iterator last = list.end();
+        if (list.size() == 0 || !comp(value, *--last))
+            return list.insert(list.end(), value); // appending in order is the common case
+        return list.insert(upperBound(value), value);
+    }
+
+    /**
+     * Insert using hint as a finger: O(1) when value belongs at most one
+     * position before or after hint, otherwise a walk outward from hint
+     * (a search when indexed).
+     */
+    Iterator insert(Iterator hint, const T &value)
+    {
+        Iterator pos = hint;
+        if (pos != list.end() && !comp(value, *pos))
+        {
+            ++pos;
+            while (pos != list.end() && !comp(value, *pos))
+            {
+                if (list.isIndexed())
+                    return insert(value); // more than one step off: search instead
+                ++pos;
+            }
+            return list.insert(pos, value);
+        }
+        while (pos != list.begin())
+        {
+            Iterator before = pos;
+            --before;
+            if (!comp(value, *before))
+                break;
+            if (list.isIndexed() && pos != hint)
+                return insert(value); // more than one step off: search instead
+            pos = before;
+        }
+        return list.insert(pos, value);
+    }
+
+    // First element not less than value, or end()
+    Iterator lowerBound(const T &value) const
+    {
+        return list.partitionPoint([&](const T &x) { return comp(x, value); });
+    }
+
+    // First element greater than value, or end()
+    Iterator upperBound(const T &value) const
+    {
+        return list.partitionPoint([&](const T &x) { return !comp(value, x); });
+    }
+
+    bool contains(const T &value) const
+    {
+        Iterator it = lowerBound(value);
+        return it != list.end() && !comp(value, *it);
+    }
+
+    // Remove the first element equal to value; false if there is none
+    bool remove(const T &value)
+    {
+        Iterator it = lowerBound(value);
+        if (it == list.end() || comp(value, *it))
+            return false;
+        list.erase(it);
+        return true;
+    }
+
+    Iterator erase(Iterator pos)
+    {
+        return list.erase(pos);
+    }
+
+    void deleteAt(int index)
+    {
+        list.deleteAt(index);
+    }
+
+    const T &get(int index) const
+    {
+        return list.get(index);
+    }
+
+    /**
+     * Move every element of other into this list in O(n + m) by relinking
+     * its nodes; other is left empty. Equal elements from this list stay in
+     * front of those from other.
+     */
+    void mergeSorted(SortedDoublyLinkedList &other)
+    {
+        list.merge(other.list, comp);
+    }
+
+    // Keep only the first of each run of equal elements; returns how many were removed
+    int unique()
+    {
+        return list.unique([&](const T &a, const T &b) { return !comp(a, b); });
+    }
+
+    int size() const
+    {
+        return list.size();
+    }
+
+    void clear()
+    {
+        list.clear();
+    }
+
+    string toString(string (*convert2str)(T &) = 0) const
+    {
+        return list.toString(convert2str);
+    }
+
+    // Read-only view of the underlying list, for its scans and parallel algorithms
+    const DoublyLinkedList<T> &items() const
+    {
+        return list;
+    }
+
+    Iterator begin() const
+    {
+        return list.begin();
+    }
+
+    Iterator end() const
+    {
+        return list.end();
+    }
+};
+
+#endif // __SORTED_DOUBLY_LINKED_LIST_H__
@@ -0,0 +1,219 @@
+#include "ThreadPool.h"
+#include <new>
+
+namespace
+{
+    // Which pool and worker the current thread belongs to, if any
+    thread_local const void *currentPool = nullptr;
+    thread_local int currentIndex = -1;
+    // Pool whose task the current thread is running (helpers outside the pool included)
+    thread_local const void *runningPool = nullptr;
+
+    unsigned nextRandom()
+    {
+        thread_local unsigned state = 0x9E3779B9u ^ unsigned(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+}
+
+ThreadPool::TaskDeque::TaskDeque()
+{
+    head.next = &tail;
+    tail.prev = &head;
+}
+
+ThreadPool::TaskDeque::~TaskDeque()
+{
+    for (TaskNode *curr = head.next; curr != &tail;)
+    {
+        TaskNode *next = curr->next;
+        curr->~TaskNode();
+        curr = next;
+    }
+}
+
+std::function<void()> ThreadPool::TaskDeque::take(TaskNode *node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    std::function<void()> task = std::move(node->task);
+    node->~TaskNode();
+    pool.deallocate(node);
+    return task;
+}
+
+void ThreadPool::TaskDeque::pushBack(std::function<void()> task)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    void *mem = pool.allocate();
+    TaskNode *node = new (mem) TaskNode();
+    node->task = std::move(task);
+    node->prev = tail.prev;
+    node->next = &tail;
+    tail.prev->next = node;
+    tail.prev = node;
+}
+
+bool ThreadPool::TaskDeque::popBack(std::function<void()> &task)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (tail.prev == &head)
+        return false;
+    task = take(tail.prev);
+    return true;
+}
+
+bool ThreadPool::TaskDeque::stealFront(std::function<void()> &task)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (head.next == &tail)
+        return false;
+    task = take(head.next);
+    return true;
+}
+
+ThreadPool::ThreadPool(int threads) : queued(0), pending(0), nextWorker(0), stealCount(0)
+{
+    if (threads < 1)
+        threads = 1;
+    for (int i = 0; i < threads; ++i)
+        workers.emplace_back(new Worker());
+    for (int i = 0; i < threads; ++i)
+        workers[i]->thread = std::thread(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> guard(sleepLock);
+        idle.wait(guard, [this] { return pending.load() == 0; });
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::unique_ptr<Worker> &w : workers)
+        w->thread.join();
+}
+
+int ThreadPool::size() const
+{
+    return int(workers.size());
+}
+
+long ThreadPool::steals() const
+{
+    return stealCount.load(std::memory_order_relaxed);
+}
+
+int ThreadPool::currentWorker() const
+{
+    return currentPool == this ? currentIndex : -1;
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    int self = currentWorker();
+    int target = self >= 0 ? self : int(nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size());
+    pending.fetch_add(1);
+    workers[target]->deque.pushBack(std::move(task));
+    queued.fetch_add(1);
+    {
+        // Taking the lock orders this notify after a sleeper's predicate check
+        std::lock_guard<std::mutex> guard(sleepLock);
+    }
+    wake.notify_one();
+}
+
+bool ThreadPool::findTask(int self, std::function<void()> &task)
+{
+    if (self >= 0 && workers[self]->deque.popBack(task))
+        return true;
+    // Steal from the head of the others, starting at a random victim
+    int n = size();
+    int start = int(nextRandom() % unsigned(n));
+    for (int k = 0; k < n; ++k)
+    {
+        int victim = (start + k) % n;
+        if (victim != self && workers[victim]->deque.stealFront(task))
+        {
+            stealCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::runTask(std::function<void()> &task)
+{
+    queued.fetch_sub(1);
+    const void *outer = runningPool;
+    runningPool = this;
+    try
+    {
+        task();
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        if (!failure)
+            failure = std::current_exception();
+    }
+    runningPool = outer;
+    task = nullptr; // release captures before reporting completion
+    if (pending.fetch_sub(1) == 1)
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        idle.notify_all();
+    }
+}
+
+bool ThreadPool::runOne()
+{
+    std::function<void()> task;
+    if (!findTask(currentWorker(), task))
+        return false;
+    runTask(task);
+    return true;
+}
+
+void ThreadPool::workerLoop(int self)
+{
+    currentPool = this;
+    currentIndex = self;
+    std::function<void()> task;
+    while (true)
+    {
+        if (findTask(self, task))
+        {
+            runTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(sleepLock);
+        if (stopping)
+            return;
+        if (queued.load() == 0)
+            wake.wait(guard, [this] { return stopping || queued.load() > 0; });
+    }
+}
+
+void ThreadPool::wait()
+{
+    if (currentWorker() >= 0 || runningPool == this)
+        throw std::logic_error("ThreadPool::wait called from one of its own tasks");
+    while (pending.load() > 0)
+    {
+        if (runOne())
+            continue;
+        std::unique_lock<std::mutex> guard(sleepLock);
+        idle.wait_for(guard, std::chrono::milliseconds(1), [this] { return pending.load() == 0; });
+    }
+    std::lock_guard<std::mutex> guard(sleepLock);
+    if (failure)
+    {
+        std::exception_ptr error = failure;
+        failure = nullptr;
+        std::rethrow_exception(error);
+    }
+}
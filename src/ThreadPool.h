@@ -0,0 +1,147 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include "main.h"
+#include "NodePool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Work-stealing thread pool
+ *
+ * Each worker owns a deque of tasks: a sentinel-bounded doubly linked list
+ * with pooled nodes, like DoublyLinkedList. The owner pushes and pops at
+ * the tail (newest first, which keeps nested work cache-hot) while idle
+ * workers steal from the head (oldest first, which tends to be the biggest
+ * piece of remaining work). Tasks submitted from inside a task go to the
+ * submitting worker's own deque; tasks from other threads are dealt round
+ * robin.
+ *
+ * An exception thrown by a submitted task is kept and rethrown by the next
+ * wait(); parallel_for rethrows the first exception from its own body.
+ * wait() is for threads outside the pool: a task that needs to wait for
+ * work it spawned should use parallel_for, which runs tasks while it waits.
+ */
+class ThreadPool
+{
+private:
+    struct TaskNode
+    {
+        std::function<void()> task;
+        TaskNode *prev = nullptr;
+        TaskNode *next = nullptr;
+    };
+
+    class TaskDeque
+    {
+    private:
+        TaskNode head; // Dummy head
+        TaskNode tail; // Dummy tail
+        NodePool<TaskNode> pool;
+        std::mutex lock;
+
+        std::function<void()> take(TaskNode *node);
+
+    public:
+        TaskDeque();
+        ~TaskDeque();
+        void pushBack(std::function<void()> task);
+        // Owner side; false when empty
+        bool popBack(std::function<void()> &task);
+        // Thief side; false when empty
+        bool stealFront(std::function<void()> &task);
+    };
+
+    struct Worker
+    {
+        TaskDeque deque;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<int> queued;  // tasks sitting in some deque
+    std::atomic<int> pending; // tasks submitted and not yet finished
+    std::atomic<unsigned> nextWorker;
+    std::atomic<long> stealCount;
+    std::mutex sleepLock;
+    std::condition_variable wake; // workers: a task was queued or the pool is stopping
+    std::condition_variable idle; // wait(): pending reached zero
+    bool stopping = false;
+    std::exception_ptr failure;
+
+    int currentWorker() const;
+    bool findTask(int self, std::function<void()> &task);
+    void runTask(std::function<void()> &task);
+    void workerLoop(int self);
+
+public:
+    explicit ThreadPool(int threads = int(std::thread::hardware_concurrency()));
+    // Finishes every submitted task, then joins the workers
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    int size() const;
+    void submit(std::function<void()> task);
+    // Block until every submitted task has finished; the caller runs tasks meanwhile
+    void wait();
+    // Run one queued task on the calling thread; false if none was found
+    bool runOne();
+    // Tasks taken from another worker's deque so far
+    long steals() const;
+
+    /**
+     * Call fn(i) for every i in [first, last), split into chunks of about
+     * grain indices (0 picks a size that gives each worker several chunks).
+     * The calling thread runs chunks too, so this may be nested inside tasks.
+     */
+    template <typename Fn>
+    void parallel_for(int first, int last, Fn fn, int grain = 0)
+    {
+        if (first >= last)
+            return;
+        int count = last - first;
+        if (grain <= 0)
+            grain = std::max(1, count / (8 * size()));
+        int chunks = (count + grain - 1) / grain;
+
+        std::atomic<int> remaining(chunks);
+        std::exception_ptr error;
+        std::mutex errorLock;
+        auto runChunk = [&](int begin) {
+            try
+            {
+                int end = std::min(last, begin + grain);
+                for (int i = begin; i < end; ++i)
+                    fn(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard(errorLock);
+                if (!error)
+                    error = std::current_exception();
+            }
+            remaining.fetch_sub(1, std::memory_order_release);
+        };
+        for (int c = 1; c < chunks; ++c)
+            submit([&runChunk, first, c, grain] { runChunk(first + c * grain); });
+        runChunk(first);
+        while (remaining.load(std::memory_order_acquire) > 0)
+        {
+            if (!runOne())
+                std::this_thread::yield();
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+};
+
+#endif // __THREAD_POOL_H__
@@ -0,0 +1,389 @@
+#include "UnrolledLinkedList.h"
+#include "ValueFormat.h"
+#include <algorithm>
+
+template <typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList() : length(0)
+{
+    head.next = &tail;
+    tail.prev = &head;
+}
+
+template <typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(const UnrolledLinkedList &other) : UnrolledLinkedList()
+{
+    // Copy node by node; the source layout is already densely packed
+    for (Link *curr = other.head.next; curr != &other.tail; curr = curr->next)
+    {
+        Node *node = addNodeAfter(tail.prev);
+        std::copy(asNode(curr)->items, asNode(curr)->items + curr->count, node->items);
+        node->count = curr->count;
+        length += curr->count;
+    }
+}
+
+template <typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(UnrolledLinkedList &&other) noexcept : UnrolledLinkedList()
+{
+    takeNodes(other);
+}
+
+template <typename T>
+UnrolledLinkedList<T>::~UnrolledLinkedList()
+{
+    clear();
+}
+
+template <typename T>
+UnrolledLinkedList<T> &UnrolledLinkedList<T>::operator=(const UnrolledLinkedList &other)
+{
+    if (this != &other)
+    {
+        UnrolledLinkedList tmp(other);
+        swap(tmp);
+    }
+    return *this;
+}
+
+template <typename T>
+UnrolledLinkedList<T> &UnrolledLinkedList<T>::operator=(UnrolledLinkedList &&other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        takeNodes(other);
+    }
+    return *this;
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::swap(UnrolledLinkedList &other) noexcept
+{
+    if (this == &other)
+        return;
+    UnrolledLinkedList tmp(std::move(other));
+    other.takeNodes(*this);
+    takeNodes(tmp);
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::clear()
+{
+    Link *curr = head.next;
+    while (curr != &tail)
+    {
+        Link *tmp = curr;
+        curr = curr->next;
+        destroyNode(asNode(tmp));
+    }
+    head.next = &tail;
+    tail.prev = &head;
+    length = 0;
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::takeNodes(UnrolledLinkedList &other)
+{
+    pool.swap(other.pool);
+    if (other.length == 0)
+        return;
+    Link *first = other.head.next;
+    Link *last = other.tail.prev;
+    head.next = first;
+    first->prev = &head;
+    tail.prev = last;
+    last->next = &tail;
+    length = other.length;
+
+    other.head.next = &other.tail;
+    other.tail.prev = &other.head;
+    other.length = 0;
+}
+
+template <typename T>
+typename UnrolledLinkedList<T>::Node *UnrolledLinkedList<T>::createNode()
+{
+    void *mem = pool.allocate();
+    try
+    {
+        return new (mem) Node();
+    }
+    catch (...)
+    {
+        pool.deallocate(mem);
+        throw;
+    }
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::destroyNode(Node *node)
+{
+    node->~Node();
+    pool.deallocate(node);
+}
+
+template <typename T>
+typename UnrolledLinkedList<T>::Node *UnrolledLinkedList<T>::addNodeAfter(Link *pos)
+{
+    Node *node = createNode();
+    node->prev = pos;
+    node->next = pos->next;
+    pos->next->prev = node;
+    pos->next = node;
+    return node;
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::removeNode(Node *node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    destroyNode(node);
+}
+
+template <typename T>
+typename UnrolledLinkedList<T>::Node *UnrolledLinkedList<T>::locate(int index, int &offset) const
+{
+    // Skip whole nodes by their counts, starting from the nearer end
+    if (index < length / 2)
+    {
+        Link *curr = head.next;
+        while (index >= curr->count)
+        {
+            index -= curr->count;
+            curr = curr->next;
+        }
+        offset = index;
+        return asNode(curr);
+    }
+    Link *curr = tail.prev;
+    int start = length - curr->count; // position of curr's first element
+    while (index < start)
+    {
+        curr = curr->prev;
+        start -= curr->count;
+    }
+    offset = index - start;
+    return asNode(curr);
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::insertAtHead(T data)
+{
+    insertAt(0, data);
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::insertAtTail(T data)
+{
+    insertAt(length, data);
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::insertAt(int index, T data)
+{
+    if (index < 0 || index > length)
+        throw std::out_of_range("insertAt index out of range");
+
+    Node *node;
+    int offset;
+    if (index == length)
+    {
+        // Appending: fill the last node before starting a new one
+        if (tail.prev == &head || tail.prev->count == CAPACITY)
+            addNodeAfter(tail.prev);
+        node = asNode(tail.prev);
+        offset = node->count;
+    }
+    else
+    {
+        node = locate(index, offset);
+        if (offset == 0 && node->prev != &head && node->prev->count < CAPACITY)
+        {
+            // Room at the end of the previous node saves a shift
+            node = asNode(node->prev);
+            offset = node->count;
+        }
+        else if (node->count == CAPACITY)
+        {
+            // Split: move the upper half into a fresh node
+            Node *right = addNodeAfter(node);
+            int half = CAPACITY / 2;
+            std::move(node->items + half, node->items + CAPACITY, right->items);
+            right->count = CAPACITY - half;
+            node->count = half;
+            if (offset > half)
+            {
+                node = right;
+                offset -= half;
+            }
+        }
+    }
+
+    std::move_backward(node->items + offset, node->items + node->count, node->items + node->count + 1);
+    node->items[offset] = data;
+    node->count++;
+    length++;
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::deleteAt(int index)
+{
+    if (index < 0 || index >= length)
+        throw std::out_of_range("deleteAt index out of range");
+
+    int offset;
+    Node *node = locate(index, offset);
+    std::move(node->items + offset + 1, node->items + node->count, node->items + offset);
+    node->count--;
+    node->items[node->count] = T();
+    length--;
+
+    if (node->count == 0)
+    {
+        removeNode(node);
+        return;
+    }
+    // Keep nodes at least half full by merging with a small right neighbour
+    Link *next = node->next;
+    if (next != &tail && node->count < CAPACITY / 2 && node->count + next->count <= CAPACITY)
+    {
+        std::move(asNode(next)->items, asNode(next)->items + next->count, node->items + node->count);
+        node->count += next->count;
+        removeNode(asNode(next));
+    }
+}
+
+template <typename T>
+T &UnrolledLinkedList<T>::get(int index) const
+{
+    if (index < 0 || index >= length)
+        throw std::out_of_range("get index out of range");
+    int offset;
+    Node *node = locate(index, offset);
+    return node->items[offset];
+}
+
+template <typename T>
+int UnrolledLinkedList<T>::indexOf(T item) const
+{
+    int base = 0;
+    for (Link *curr = head.next; curr != &tail; curr = curr->next)
+    {
+        int found = SimdSearch::findFirst(asNode(curr)->items, curr->count, item);
+        if (found >= 0)
+            return base + found;
+        base += curr->count;
+    }
+    return -1;
+}
+
+template <typename T>
+int UnrolledLinkedList<T>::countOf(const T &item) const
+{
+    int total = 0;
+    for (Link *curr = head.next; curr != &tail; curr = curr->next)
+        total += SimdSearch::count(asNode(curr)->items, curr->count, item);
+    return total;
+}
+
+template <typename T>
+int UnrolledLinkedList<T>::indexOfAny(const T *items, int count) const
+{
+    int base = 0;
+    for (Link *curr = head.next; curr != &tail; curr = curr->next)
+    {
+        int found = SimdSearch::findFirstAny(asNode(curr)->items, curr->count, items, count);
+        if (found >= 0)
+            return base + found;
+        base += curr->count;
+    }
+    return -1;
+}
+
+template <typename T>
+bool UnrolledLinkedList<T>::contains(T item) const
+{
+    return indexOf(item) != -1;
+}
+
+template <typename T>
+int UnrolledLinkedList<T>::size() const
+{
+    return length;
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::reverse()
+{
+    if (length == 0)
+        return;
+    // Reverse the node chain and the items inside every node
+    Link *first = head.next;
+    Link *last = tail.prev;
+    for (Link *curr = first; curr != &tail;)
+    {
+        Link *next = curr->next;
+        std::swap(curr->prev, curr->next);
+        std::reverse(asNode(curr)->items, asNode(curr)->items + curr->count);
+        curr = next;
+    }
+    head.next = last;
+    last->prev = &head;
+    tail.prev = first;
+    first->next = &tail;
+}
+
+template <typename T>
+string UnrolledLinkedList<T>::toString(string (*convert2str)(T &) /*= 0*/) const
+{
+    string out;
+    if (!convert2str)
+    {
+        toString(out);
+        return out;
+    }
+    out += "[";
+    bool first = true;
+    for (Link *curr = head.next; curr != &tail; curr = curr->next)
+    {
+        T *items = asNode(curr)->items;
+        for (int i = 0; i < curr->count; ++i)
+        {
+            if (!first)
+                out += ", ";
+            first = false;
+            out += convert2str(items[i]);
+        }
+    }
+    out += "]";
+    return out;
+}
+
+template <typename T>
+void UnrolledLinkedList<T>::toString(string &out) const
+{
+    out.reserve(out.size() + 2 + std::size_t(length) * (ValueFormat::estimatedWidth<T>() + 2));
+    out += '[';
+    bool first = true;
+    for (Link *curr = head.next; curr != &tail; curr = curr->next)
+    {
+        T *items = asNode(curr)->items;
+        for (int i = 0; i < curr->count; ++i)
+        {
+            if (!first)
+                out += ", ";
+            first = false;
+            ValueFormat::append(out, items[i]);
+        }
+    }
+    out += ']';
+}
+
+// Explicit template instantiation for char, string, int, double, float, and Point
+template class UnrolledLinkedList<char>;
+template class UnrolledLinkedList<string>;
+template class UnrolledLinkedList<int>;
+template class UnrolledLinkedList<double>;
+template class UnrolledLinkedList<float>;
+template class UnrolledLinkedList<Point>;
@@ -0,0 +1,158 @@
+#ifndef __UNROLLED_LINKED_LIST_H__
+#define __UNROLLED_LINKED_LIST_H__
+
+#include "main.h"
+#include "NodePool.h"
+#include "SimdSearch.h"
+#include <utility>
+
+/**
+ * @class UnrolledLinkedList
+ * @brief Doubly linked list that stores a small array of elements per node
+ *
+ * Same public API as DoublyLinkedList. Packing up to CAPACITY elements into
+ * each node cuts the per-element pointer overhead and lets scans such as
+ * indexOf and toString walk contiguous memory instead of chasing a pointer
+ * per element.
+ */
+template <typename T>
+class UnrolledLinkedList
+{
+public:
+    // Aim for nodes of about 256 bytes, but never fewer than 4 elements
+    static const int CAPACITY = (256 / sizeof(T)) > 4 ? int(256 / sizeof(T)) : 4;
+
+private:
+    struct Link
+    {
+        Link *prev = nullptr;
+        Link *next = nullptr;
+        int count = 0; // always 0 for the sentinels
+    };
+
+    struct Node : Link
+    {
+        T items[CAPACITY];
+    };
+
+    Link head; // Dummy head
+    Link tail; // Dummy tail
+    int length = 0;
+    NodePool<Node> pool;
+
+    static Node *asNode(Link *link)
+    {
+        return static_cast<Node *>(link);
+    }
+
+    Node *createNode();
+    void destroyNode(Node *node);
+    // Insert an empty node after pos
+    Node *addNodeAfter(Link *pos);
+    void removeNode(Node *node);
+    // Node holding position index, and the offset of index inside it
+    Node *locate(int index, int &offset) const;
+    void takeNodes(UnrolledLinkedList &other);
+
+public:
+    UnrolledLinkedList();
+    UnrolledLinkedList(const UnrolledLinkedList &other);
+    UnrolledLinkedList(UnrolledLinkedList &&other) noexcept;
+    ~UnrolledLinkedList();
+
+    UnrolledLinkedList &operator=(const UnrolledLinkedList &other);
+    UnrolledLinkedList &operator=(UnrolledLinkedList &&other) noexcept;
+    void swap(UnrolledLinkedList &other) noexcept;
+    void clear();
+
+    void insertAtHead(T data);
+    void insertAtTail(T data);
+    void insertAt(int index, T data);
+    void deleteAt(int index);
+    T &get(int index) const;
+    int indexOf(T item) const;
+    bool contains(T item) const;
+    // Batch searches; int, float, double and char scan each node with SIMD
+    int countOf(const T &item) const;
+    int indexOfAny(const T *items, int count) const;
+    int size() const;
+    void reverse();
+    string toString(string (*convert2str)(T &) = 0) const;
+    // Append the same text to out; reuses out's capacity across calls
+    void toString(string &out) const;
+
+    class Iterator
+    {
+    private:
+        Link *current;
+        int offset;
+
+    public:
+        Iterator(Link *node, int offset = 0) : current(node), offset(offset) {}
+
+        T &operator*() const
+        {
+            return asNode(current)->items[offset];
+        }
+
+        Iterator &operator++()
+        {
+            if (++offset >= current->count)
+            {
+                current = current->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Iterator &operator--()
+        {
+            if (--offset < 0)
+            {
+                current = current->prev;
+                offset = current->count - 1;
+            }
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return current == other.current && offset == other.offset;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    Iterator begin() const
+    {
+        return Iterator(head.next);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(const_cast<Link *>(&tail));
+    }
+
+    friend void swap(UnrolledLinkedList &a, UnrolledLinkedList &b) noexcept
+    {
+        a.swap(b);
+    }
+};
+#endif // __UNROLLED_LINKED_LIST_H__
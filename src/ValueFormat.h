@@ -0,0 +1,147 @@
+#ifndef __VALUE_FORMAT_H__
+#define __VALUE_FORMAT_H__
+
+#include "main.h"
+#include <charconv>
+#include <type_traits>
+
+/**
+ * @class ValueFormat
+ * @brief Converts list elements to and from text without going through iostreams
+ *
+ * append() output is byte-for-byte what operator<< would print with default
+ * stream settings: integers in decimal, floating point like "%g" (six
+ * significant digits) and Point as "(x,y,z)". parse() reads a single field
+ * back: numbers via std::from_chars with surrounding blanks ignored, a char
+ * from a one-byte field, a string verbatim, and a Point from two or three
+ * numbers separated by blanks or commas, optionally in parentheses. Types
+ * without an overload here fall back to a stringstream.
+ */
+class ValueFormat
+{
+private:
+    template <typename Number, typename... Format>
+    static void appendNumber(string &out, Number value, Format... format)
+    {
+        char buffer[32];
+        std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value, format...);
+        out.append(buffer, result.ptr);
+    }
+
+    static bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    template <typename Number>
+    static bool parseNumber(const char *first, const char *last, Number &value)
+    {
+        while (first != last && isBlank(*first))
+            ++first;
+        while (last != first && isBlank(last[-1]))
+            --last;
+        std::from_chars_result result = std::from_chars(first, last, value);
+        return first != last && result.ec == std::errc() && result.ptr == last;
+    }
+
+public:
+    template <typename T>
+    static void append(string &out, const T &value)
+    {
+        std::ostringstream oss;
+        oss << value;
+        out += oss.str();
+    }
+
+    static void append(string &out, char value) { out += value; }
+    static void append(string &out, const string &value) { out += value; }
+    static void append(string &out, int value) { appendNumber(out, value); }
+    static void append(string &out, double value) { appendNumber(out, value, std::chars_format::general, 6); }
+    static void append(string &out, float value) { appendNumber(out, value, std::chars_format::general, 6); }
+
+    static void append(string &out, const Point &value)
+    {
+        out += '(';
+        append(out, value.getX());
+        out += ',';
+        append(out, value.getY());
+        out += ',';
+        append(out, value.getZ());
+        out += ')';
+    }
+
+    // Parse the field [first, last) into value; false if it is malformed
+    template <typename T>
+    static bool parse(const char *first, const char *last, T &value)
+    {
+        std::istringstream iss(string(first, last));
+        return bool(iss >> value);
+    }
+
+    static bool parse(const char *first, const char *last, char &value)
+    {
+        if (last - first != 1)
+            return false;
+        value = *first;
+        return true;
+    }
+
+    static bool parse(const char *first, const char *last, string &value)
+    {
+        value.assign(first, last);
+        return true;
+    }
+
+    static bool parse(const char *first, const char *last, int &value) { return parseNumber(first, last, value); }
+    static bool parse(const char *first, const char *last, double &value) { return parseNumber(first, last, value); }
+    static bool parse(const char *first, const char *last, float &value) { return parseNumber(first, last, value); }
+
+    static bool parse(const char *first, const char *last, Point &value)
+    {
+        double xyz[3] = {0, 0, 0};
+        int found = 0;
+        const char *p = first;
+        while (p != last && isBlank(*p))
+            ++p;
+        bool paren = p != last && *p == '(';
+        if (paren)
+            ++p;
+        while (found < 3)
+        {
+            while (p != last && (isBlank(*p) || (found > 0 && *p == ',')))
+                ++p;
+            std::from_chars_result result = std::from_chars(p, last, xyz[found]);
+            if (result.ec != std::errc())
+                break;
+            p = result.ptr;
+            ++found;
+        }
+        while (p != last && isBlank(*p))
+            ++p;
+        if (paren)
+        {
+            if (p == last || *p != ')')
+                return false;
+            ++p;
+            while (p != last && isBlank(*p))
+                ++p;
+        }
+        if (found < 2 || p != last)
+            return false;
+        value = Point(xyz[0], xyz[1], xyz[2]);
+        return true;
+    }
+
+    // Rough printed size of one element, used to reserve the output once
+    template <typename T>
+    static int estimatedWidth()
+    {
+        if (std::is_same<T, char>::value)
+            return 1;
+        if (std::is_same<T, Point>::value)
+            return 24;
+        return 8;
+    }
+};
+
+#endif // __VALUE_FORMAT_H__
@@ -0,0 +1,170 @@
+#include "VersionedList.h"
+#include <utility>
+
+template <typename T>
+VersionedList<T>::VersionedList() : history(1), current(0)
+{
+}
+
+template <typename T>
+CowList<T> &VersionedList<T>::edit()
+{
+    // Versions after the current one belonged to undone edits
+    history.resize(current + 1);
+    // O(1): the new version shares every node until the edit copies its path
+    history.push_back(history[current]);
+    ++current;
+    return history[current];
+}
+
+template <typename T>
+void VersionedList<T>::insertAtHead(const T &data)
+{
+    insertAt(0, data);
+}
+
+template <typename T>
+void VersionedList<T>::insertAtTail(const T &data)
+{
+    insertAt(size(), data);
+}
+
+template <typename T>
+void VersionedList<T>::insertAt(int index, const T &data)
+{
+    if (index < 0 || index > size())
+        throw std::out_of_range("insertAt index out of range");
+    edit().insertAt(index, data);
+}
+
+template <typename T>
+void VersionedList<T>::deleteAt(int index)
+{
+    if (index < 0 || index >= size())
+        throw std::out_of_range("deleteAt index out of range");
+    edit().deleteAt(index);
+}
+
+template <typename T>
+void VersionedList<T>::set(int index, const T &data)
+{
+    if (index < 0 || index >= size())
+        throw std::out_of_range("set index out of range");
+    edit().set(index, data);
+}
+
+template <typename T>
+void VersionedList<T>::clear()
+{
+    edit().clear();
+}
+
+template <typename T>
+int VersionedList<T>::size() const
+{
+    return history[current].size();
+}
+
+template <typename T>
+bool VersionedList<T>::empty() const
+{
+    return history[current].empty();
+}
+
+template <typename T>
+const T &VersionedList<T>::get(int index) const
+{
+    return history[current].get(index);
+}
+
+template <typename T>
+int VersionedList<T>::indexOf(const T &item) const
+{
+    return history[current].indexOf(item);
+}
+
+template <typename T>
+bool VersionedList<T>::contains(const T &item) const
+{
+    return history[current].contains(item);
+}
+
+template <typename T>
+string VersionedList<T>::toString(string (*convert2str)(T &) /*= 0*/) const
+{
+    return history[current].toString(convert2str);
+}
+
+template <typename T>
+void VersionedList<T>::toString(string &out) const
+{
+    history[current].toString(out);
+}
+
+template <typename T>
+int VersionedList<T>::versionCount() const
+{
+    return int(history.size());
+}
+
+template <typename T>
+int VersionedList<T>::currentVersion() const
+{
+    return current;
+}
+
+template <typename T>
+typename VersionedList<T>::Version VersionedList<T>::version(int v) const
+{
+    if (v < 0 || v >= int(history.size()))
+        throw std::out_of_range("version out of range");
+    return history[v].snapshot();
+}
+
+template <typename T>
+bool VersionedList<T>::canUndo() const
+{
+    return current > 0;
+}
+
+template <typename T>
+bool VersionedList<T>::canRedo() const
+{
+    return current + 1 < int(history.size());
+}
+
+template <typename T>
+bool VersionedList<T>::undo()
+{
+    if (!canUndo())
+        return false;
+    --current;
+    return true;
+}
+
+template <typename T>
+bool VersionedList<T>::redo()
+{
+    if (!canRedo())
+        return false;
+    ++current;
+    return true;
+}
+
+template <typename T>
+void VersionedList<T>::compact()
+{
+    // Chunks only older versions used are freed with them
+    CowList<T> kept = history[current];
+    history.clear();
+    history.push_back(std::move(kept));
+    current = 0;
+}
+
+// Explicit template instantiation for char, string, int, double, float, and Point
+template class VersionedList<char>;
+template class VersionedList<string>;
+template class VersionedList<int>;
+template class VersionedList<double>;
+template class VersionedList<float>;
+template class VersionedList<Point>;
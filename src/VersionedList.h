@@ -0,0 +1,80 @@
+#ifndef __VERSIONED_LIST_H__
+#define __VERSIONED_LIST_H__
+
+#include "main.h"
+#include "CowList.h"
+#include <vector>
+
+/**
+ * @class VersionedList
+ * @brief Persistent list where every edit makes a new version
+ *
+ * Each version is a CowList sharing every chunk it did not change with the
+ * version before it, so an edit costs one root-to-leaf path of memory
+ * (O(log n) nodes) instead of a copy of the whole list. Reads go to the
+ * current version; version(v) returns any older one as a read-only
+ * snapshot with the same get/toString/iteration API.
+ *
+ * undo() and redo() move between versions without copying anything. An
+ * edit made after an undo drops the versions that could have been redone,
+ * like an editor's history.
+ */
+template <typename T>
+class VersionedList
+{
+public:
+    typedef typename CowList<T>::Snapshot Version;
+    typedef typename CowList<T>::Iterator Iterator;
+
+private:
+    std::vector<CowList<T>> history; // history[0] is the empty list
+    int current;
+
+    // Start a new version from the current one and return it for editing
+    CowList<T> &edit();
+
+public:
+    VersionedList();
+
+    // Editing; each call adds one version
+    void insertAtHead(const T &data);
+    void insertAtTail(const T &data);
+    void insertAt(int index, const T &data);
+    void deleteAt(int index);
+    void set(int index, const T &data);
+    void clear();
+
+    // Reading the current version
+    int size() const;
+    bool empty() const;
+    const T &get(int index) const;
+    int indexOf(const T &item) const;
+    bool contains(const T &item) const;
+    string toString(string (*convert2str)(T &) = 0) const;
+    void toString(string &out) const;
+
+    Iterator begin() const
+    {
+        return history[current].begin();
+    }
+
+    Iterator end() const
+    {
+        return history[current].end();
+    }
+
+    // History
+    int versionCount() const;
+    int currentVersion() const;
+    // Read-only view of version v, valid for as long as the caller keeps it
+    Version version(int v) const;
+    bool canUndo() const;
+    bool canRedo() const;
+    // Step back (or forward) one version; false when there is none
+    bool undo();
+    bool redo();
+    // Forget every version except the current one, which becomes version 0
+    void compact();
+};
+
+#endif // __VERSIONED_LIST_H__
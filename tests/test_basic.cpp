@@ -1,5 +1,7 @@
 #include "doctest/doctest.h"
 #include "src/DoublyLinkedList.h"
+#include <algorithm>
+#include <vector>
 
 TEST_SUITE("DoublyLinkedList Basic Operations")
 {
@@ -496,6 +498,104 @@ TEST_SUITE("DoublyLinkedList - Extended Tests")
         CHECK(dst.get(1) == 2);
     }
 
+    /* --------------------------------------------------------------------- */
+    TEST_CASE("Copy assignment reuses nodes and matches the copy constructor")
+    {
+        DoublyLinkedList<std::string> big, small;
+        for (const char *s : {"a","b","c","d"}) big.insertAtTail(s);
+        small.insertAtTail("x");
+        small.insertAtTail("y");
+        std::string *firstNode = &small.get(0);
+
+        small = big;                     // grow: 2 reused + 2 new
+        CHECK(small.toString() == "[a, b, c, d]");
+        CHECK(&small.get(0) == firstNode);
+        CHECK(small.size() == 4);
+
+        std::vector<std::string *> before;
+        for (int i = 0; i < small.size(); ++i) before.push_back(&small.get(i));
+        DoublyLinkedList<std::string> two;
+        two.insertAtTail("p");
+        two.insertAtTail("q");
+        small = two;                     // shrink: 2 reused, 2 freed
+        CHECK(small.toString() == "[p, q]");
+        CHECK(small.size() == 2);
+        CHECK(&small.get(0) == before[0]);
+        CHECK(&small.get(1) == before[1]);
+        DoublyLinkedList<std::string> same;
+        same.insertAtTail("s");
+        same.insertAtTail("t");
+        small = same;                    // equal length: every node reused
+        CHECK(&small.get(0) == before[0]);
+        CHECK(&small.get(1) == before[1]);
+        CHECK(small.toString() == "[s, t]");
+        small.insertAtTail("r");
+        CHECK(small.get(2) == "r");
+
+        DoublyLinkedList<std::string> none;
+        small = none;
+        CHECK(small.size() == 0);
+        CHECK(small.begin() == small.end());
+
+        big = big;                       // self-assignment
+        CHECK(big.size() == 4);
+
+        big.reverse();
+        DoublyLinkedList<std::string> copy(big);
+        CHECK(copy.toString() == "[d, c, b, a]");
+
+        // Index settings come from the source, exactly as with copy construction
+        DoublyLinkedList<int> indexed, plain;
+        indexed.enableIndex();
+        indexed.enableHashIndex();
+        for (int i = 0; i < 100; ++i) indexed.insertAtTail(i);
+        plain.insertAtTail(-1);
+        plain = indexed;
+        DoublyLinkedList<int> constructed(indexed);
+        CHECK(plain.isIndexed() == constructed.isIndexed());
+        CHECK(plain.contains(99));
+        CHECK(plain.indexOf(-1) == -1);
+        CHECK(plain.isHashIndexed() == constructed.isHashIndexed());
+        CHECK(plain.isIndexed());
+        CHECK(plain.indexOf(70) == 70);
+        CHECK(plain.get(99) == 99);
+
+        DoublyLinkedList<int> shorter;
+        shorter.enableHashIndex();
+        for (int i = 0; i < 10; ++i) shorter.insertAtTail(i * 3);
+        int *reused = &indexed.get(5);
+        indexed = shorter;               // reuses nodes; both indexes must be rebuilt
+        CHECK(&indexed.get(5) == reused);
+        CHECK_FALSE(indexed.isIndexed());
+        CHECK(indexed.isHashIndexed());
+        CHECK(indexed.indexOf(27) == 9);
+        CHECK_FALSE(indexed.contains(50));
+
+        DoublyLinkedList<int> flat;
+        flat.insertAtTail(1);
+        indexed = flat;                  // and they are dropped when the source has none
+        CHECK_FALSE(indexed.isIndexed());
+        CHECK_FALSE(indexed.isHashIndexed());
+        CHECK(indexed.toString() == "[1]");
+    }
+
+    /* --------------------------------------------------------------------- */
+    TEST_CASE("Deleted nodes are recycled by later inserts")
+    {
+        DoublyLinkedList<std::string> list;
+        for (const char *s : {"a","b","c"}) list.insertAtTail(s);
+        std::string *middle = &list.get(1);
+        list.deleteAt(1);                // [a,c]
+        list.insertAtHead("z");          // takes the freed slot
+        CHECK(&list.get(0) == middle);
+        CHECK(list.toString() == "[z, a, c]");
+
+        list.clear();
+        for (int i = 0; i < 100; ++i) list.insertAtTail(std::to_string(i));
+        CHECK(list.size() == 100);
+        CHECK(list.get(99) == "99");
+    }
+
     /* --------------------------------------------------------------------- */
     TEST_CASE("Move constructor and move assignment")
     {
@@ -507,11 +607,66 @@ TEST_SUITE("DoublyLinkedList - Extended Tests")
         CHECK(moved.size() == 1);
         CHECK(moved.get(0) == 99);
 
+        // moved-from list is valid and empty
+        CHECK(temp.size() == 0);
+        CHECK(temp.begin() == temp.end());
+        temp.insertAtTail(7);
+        CHECK(temp.get(0) == 7);
+
         // move-assignment
         DoublyLinkedList<int> target;
+        target.insertAtTail(1);
+        target.insertAtTail(2);
         target = std::move(moved);
         CHECK(target.size() == 1);
         CHECK(target.get(0) == 99);
+        CHECK(moved.size() == 0);
+        CHECK(moved.toString() == "[]");
+    }
+
+    /* --------------------------------------------------------------------- */
+    TEST_CASE("Move keeps the same nodes and works after reverse")
+    {
+        DoublyLinkedList<int> src;
+        for (int i : {1,2,3}) src.insertAtTail(i);
+        src.reverse();                 // [3,2,1]
+        int *first = &src.get(0);
+
+        DoublyLinkedList<int> dst(std::move(src));
+        CHECK(&dst.get(0) == first);   // no element was copied
+        CHECK(dst.toString() == "[3, 2, 1]");
+        CHECK(src.size() == 0);
+
+        dst.insertAtHead(4);
+        dst.insertAtTail(0);
+        CHECK(dst.toString() == "[4, 3, 2, 1, 0]");
+    }
+
+    /* --------------------------------------------------------------------- */
+    TEST_CASE("swap exchanges contents")
+    {
+        DoublyLinkedList<std::string> a, b;
+        a.insertAtTail("x");
+        a.insertAtTail("y");
+        b.insertAtTail("z");
+
+        a.swap(b);
+        CHECK(a.toString() == "[z]");
+        CHECK(b.toString() == "[x, y]");
+
+        swap(a, b);
+        CHECK(a.size() == 2);
+        CHECK(b.size() == 1);
+
+        DoublyLinkedList<std::string> empty;
+        empty.swap(a);
+        CHECK(a.size() == 0);
+        CHECK(empty.toString() == "[x, y]");
+
+        a.clear();
+        empty.clear();
+        CHECK(empty.size() == 0);
+        CHECK(empty.begin() == empty.end());
     }
 
     /* --------------------------------------------------------------------- */
@@ -564,3 +719,243 @@ TEST_SUITE("DoublyLinkedList - Extended Tests")
         CHECK(list.size() == 4);
     }
 }
+
+TEST_SUITE("DoublyLinkedList Lazy Reverse")
+{
+    // Eager model of the old behaviour: reverse really reorders the elements
+    static void checkSame(const DoublyLinkedList<int> &list, const std::vector<int> &model)
+    {
+        REQUIRE(list.size() == int(model.size()));
+        std::ostringstream expected;
+        expected << "[";
+        for (size_t i = 0; i < model.size(); ++i)
+            expected << (i ? ", " : "") << model[i];
+        expected << "]";
+        CHECK(list.toString() == expected.str());
+
+        size_t idx = 0;
+        for (int x : list) REQUIRE(x == model[idx++]);
+        CHECK(idx == model.size());
+        auto it = list.end();
+        for (size_t i = model.size(); i-- > 0;) { --it; REQUIRE(*it == model[i]); }
+        CHECK(it == list.begin());
+        for (size_t i = 0; i < model.size(); ++i) REQUIRE(list.get(int(i)) == model[i]);
+    }
+
+    static void randomOps(DoublyLinkedList<int> &list)
+    {
+        std::vector<int> model;
+        unsigned state = 99;
+        auto next = [&state]() { state = state * 1103515245u + 12345u; return int(state >> 8); };
+        for (int step = 0; step < 600; ++step)
+        {
+            int op = next() % 7;
+            if (op == 0)
+            {
+                list.reverse();
+                std::reverse(model.begin(), model.end());
+            }
+            else if (op == 1)
+            {
+                list.insertAtHead(step);
+                model.insert(model.begin(), step);
+            }
+            else if (op == 2)
+            {
+                list.insertAtTail(step);
+                model.push_back(step);
+            }
+            else if (op <= 4 || model.empty())
+            {
+                int pos = next() % (int(model.size()) + 1);
+                list.insertAt(pos, step % 50);
+                model.insert(model.begin() + pos, step % 50);
+            }
+            else if (op == 5)
+            {
+                int pos = next() % int(model.size());
+                list.deleteAt(pos);
+                model.erase(model.begin() + pos);
+            }
+            else
+            {
+                int value = next() % 50;
+                auto found = std::find(model.begin(), model.end(), value);
+                int expected = found == model.end() ? -1 : int(found - model.begin());
+                REQUIRE(list.indexOf(value) == expected);
+            }
+            if (step % 100 == 0)
+                checkSame(list, model);
+        }
+        checkSame(list, model);
+    }
+
+    TEST_CASE("reverse is equivalent to reordering under random operations")
+    {
+        DoublyLinkedList<int> plain;
+        randomOps(plain);
+
+        DoublyLinkedList<int> indexed;
+        indexed.enableIndex();
+        indexed.enableHashIndex();
+        randomOps(indexed);
+    }
+
+    TEST_CASE("copy and findNode of a reversed list")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 1; i <= 4; ++i) list.insertAtTail(i);
+        list.reverse();                                   // [4,3,2,1]
+
+        DoublyLinkedList<int> copy(list);
+        CHECK(copy.toString() == "[4, 3, 2, 1]");
+        copy.insertAtTail(0);
+        CHECK(copy.toString() == "[4, 3, 2, 1, 0]");
+
+        DoublyLinkedList<int> assigned;
+        assigned.insertAtTail(9);
+        assigned = list;
+        CHECK(assigned.toString() == "[4, 3, 2, 1]");
+
+        auto it = list.findNode(3);
+        ++it;
+        CHECK(*it == 2);
+
+        list.reverse();
+        CHECK(list.toString() == "[1, 2, 3, 4]");
+        list.clear();
+        list.insertAtTail(5);
+        list.insertAtHead(6);
+        CHECK(list.toString() == "[6, 5]");
+    }
+}
+
+TEST_SUITE("DoublyLinkedList Move Insert and Emplace")
+{
+    TEST_CASE("rvalue inserts move the string into the node")
+    {
+        DoublyLinkedList<string> list;
+        string big(100, 'a');
+        const char *buffer = big.data();
+        list.insertAtTail(std::move(big));
+        CHECK(list.get(0).data() == buffer);
+
+        string head(100, 'h');
+        list.insertAtHead(std::move(head));
+        string mid(100, 'm');
+        list.insertAt(1, std::move(mid));
+        CHECK(list.get(0) == string(100, 'h'));
+        CHECK(list.get(1) == string(100, 'm'));
+        CHECK(list.get(2) == string(100, 'a'));
+
+        string copied = "keep";
+        list.insertAtTail(copied);
+        CHECK(copied == "keep");
+        CHECK(list.get(3) == "keep");
+        CHECK_THROWS_AS(list.insertAt(9, string("x")), std::out_of_range);
+    }
+
+    TEST_CASE("emplace functions construct in place and return the element")
+    {
+        DoublyLinkedList<string> list;
+        list.emplaceAtTail(3, 'b');
+        list.emplaceAtHead("aa");
+        string &mid = list.emplaceAt(1, 2, 'z');
+        mid += "!";
+        CHECK(list.toString() == "[aa, zz!, bbb]");
+        CHECK_THROWS_AS(list.emplaceAt(-1, "x"), std::out_of_range);
+
+        DoublyLinkedList<Point> points;
+        points.emplaceAtTail(1.0, 2.0, 3.0);
+        points.reverse();
+        points.emplaceAtTail(4.0, 5.0);
+        CHECK(points.get(1) == Point(4, 5));
+    }
+
+    TEST_CASE("lookups take const references")
+    {
+        DoublyLinkedList<string> list;
+        list.emplaceAtTail("alpha");
+        list.emplaceAtTail("beta");
+        const string key = "beta";
+        CHECK(list.indexOf(key) == 1);
+        CHECK(list.contains(key));
+        CHECK_FALSE(list.contains("gamma"));
+    }
+}
+
+TEST_SUITE("DoublyLinkedList Buffered toString")
+{
+    // Reference output: what the stream-based toString used to produce
+    template <typename T>
+    string streamed(const DoublyLinkedList<T> &list)
+    {
+        std::ostringstream oss;
+        oss << "[";
+        bool first = true;
+        for (const T &value : list)
+        {
+            if (!first)
+                oss << ", ";
+            first = false;
+            oss << value;
+        }
+        oss << "]";
+        return oss.str();
+    }
+
+    TEST_CASE("numbers format exactly like operator<<")
+    {
+        DoublyLinkedList<double> doubles;
+        DoublyLinkedList<float> floats;
+        DoublyLinkedList<int> ints;
+        double samples[] = {0.0, -0.0, 1.0, -2.5, 0.1, 1.0 / 3, 123456.0, 1234567.0, 1e-5, 1e-4,
+                            6.02214076e23, -1.5e-300, 1e300 * 10, -1e300 * 10, 0.000123456789, 99999.95};
+        for (double d : samples)
+        {
+            doubles.insertAtTail(d);
+            floats.insertAtTail(float(d));
+        }
+        int intSamples[] = {0, -1, 42, 2147483647, -2147483647 - 1};
+        for (int i : intSamples)
+            ints.insertAtTail(i);
+
+        CHECK(doubles.toString() == streamed(doubles));
+        CHECK(floats.toString() == streamed(floats));
+        CHECK(ints.toString() == streamed(ints));
+    }
+
+    TEST_CASE("Point, char and string keep the existing format")
+    {
+        DoublyLinkedList<Point> points;
+        points.insertAtTail(Point(1, 2.5, -3));
+        points.insertAtTail(Point(0.1, 1e10, 1.0 / 7));
+        CHECK(points.toString() == "[(1,2.5,-3), (0.1,1e+10,0.142857)]");
+        CHECK(points.toString() == streamed(points));
+
+        DoublyLinkedList<char> chars;
+        chars.insertAtTail('a');
+        chars.insertAtTail('b');
+        CHECK(chars.toString() == "[a, b]");
+
+        DoublyLinkedList<string> words;
+        CHECK(words.toString() == "[]");
+        words.insertAtTail("x y");
+        CHECK(words.toString() == "[x y]");
+    }
+
+    TEST_CASE("toString(out) appends to the caller's buffer")
+    {
+        DoublyLinkedList<int> list;
+        list.insertAtTail(1);
+        list.insertAtTail(2);
+        string out = "list=";
+        list.toString(out);
+        CHECK(out == "list=[1, 2]");
+
+        out.clear();
+        list.reverse();
+        list.toString(out);
+        CHECK(out == "[2, 1]");
+    }
+}
@@ -0,0 +1,103 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+TEST_SUITE("DoublyLinkedList Binary Format")
+{
+    string tempPath(const char *name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    TEST_CASE("doubles and Points round-trip through a file")
+    {
+        DoublyLinkedList<double> doubles;
+        DoublyLinkedList<Point> points;
+        for (int i = 0; i < 5000; ++i)
+        {
+            doubles.insertAtTail(i * 0.25 - 7);
+            points.insertAtTail(Point(i, -i / 3.0, 1e-9 * i));
+        }
+        string doublePath = tempPath("dll_test_doubles.bin");
+        string pointPath = tempPath("dll_test_points.bin");
+        doubles.saveBinary(doublePath);
+        points.saveBinary(pointPath);
+        CHECK(std::filesystem::file_size(doublePath) == 16 + 5000 * 8);
+        CHECK(std::filesystem::file_size(pointPath) == 16 + 5000 * 24);
+
+        DoublyLinkedList<double> loadedDoubles = DoublyLinkedList<double>::loadBinary(doublePath);
+        DoublyLinkedList<Point> loadedPoints = DoublyLinkedList<Point>::loadBinary(pointPath);
+        REQUIRE(loadedDoubles.size() == 5000);
+        REQUIRE(loadedPoints.size() == 5000);
+        CHECK(loadedDoubles.toString() == doubles.toString());
+        for (int i = 0; i < 5000; i += 499)
+        {
+            CHECK(loadedPoints.get(i).getX() == points.get(i).getX());
+            CHECK(loadedPoints.get(i).getZ() == points.get(i).getZ());
+        }
+        std::remove(doublePath.c_str());
+        std::remove(pointPath.c_str());
+    }
+
+    TEST_CASE("strings are length-prefixed and may contain any byte")
+    {
+        DoublyLinkedList<string> words;
+        words.insertAtTail("");
+        words.insertAtTail(string("a\0b", 3));
+        words.insertAtTail(string(1000, 'z'));
+        string path = tempPath("dll_test_strings.bin");
+        words.saveBinary(path);
+        DoublyLinkedList<string> loaded = DoublyLinkedList<string>::loadBinary(path);
+        REQUIRE(loaded.size() == 3);
+        CHECK(loaded.get(0).empty());
+        CHECK(loaded.get(1) == string("a\0b", 3));
+        CHECK(loaded.get(2) == string(1000, 'z'));
+        std::remove(path.c_str());
+    }
+
+    TEST_CASE("a reversed list is saved in logical order")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 4; ++i)
+            list.insertAtTail(i);
+        list.reverse();
+        string path = tempPath("dll_test_reversed.bin");
+        list.saveBinary(path);
+        CHECK(DoublyLinkedList<int>::loadBinary(path).toString() == "[3, 2, 1, 0]");
+
+        DoublyLinkedList<char> empty;
+        empty.saveBinary(path);
+        CHECK(DoublyLinkedList<char>::loadBinary(path).size() == 0);
+        std::remove(path.c_str());
+    }
+
+    TEST_CASE("bad files are rejected")
+    {
+        string path = tempPath("dll_test_bad.bin");
+        DoublyLinkedList<int> ints;
+        ints.insertAtTail(1);
+        ints.insertAtTail(2);
+        ints.saveBinary(path);
+        // Wrong element type
+        CHECK_THROWS_AS(DoublyLinkedList<double>::loadBinary(path), std::runtime_error);
+
+        // Truncated payload
+        std::ostringstream bytes;
+        ints.saveBinary(bytes);
+        string data = bytes.str();
+        std::ofstream(path, std::ios::binary).write(data.data(), std::streamsize(data.size() - 1));
+        CHECK_THROWS_AS(DoublyLinkedList<int>::loadBinary(path), std::runtime_error);
+
+        // Not a list file at all
+        std::ofstream(path, std::ios::binary) << "hello, world";
+        CHECK_THROWS_AS(DoublyLinkedList<int>::loadBinary(path), std::runtime_error);
+        std::ofstream(path, std::ios::binary).flush();
+        CHECK_THROWS_AS(DoublyLinkedList<int>::loadBinary(path), std::runtime_error);
+        std::remove(path.c_str());
+
+        CHECK_THROWS_AS(DoublyLinkedList<int>::loadBinary(tempPath("dll_test_missing.bin")), std::runtime_error);
+    }
+}
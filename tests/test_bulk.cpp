@@ -0,0 +1,103 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include <sstream>
+#include <vector>
+
+TEST_SUITE("DoublyLinkedList Bulk Building")
+{
+    TEST_CASE("appendRange and assign link a whole batch")
+    {
+        std::vector<int> values = {1, 2, 3, 4, 5};
+        DoublyLinkedList<int> list;
+        list.insertAtTail(0);
+        list.appendRange(values.begin(), values.end());
+        CHECK(list.toString() == "[0, 1, 2, 3, 4, 5]");
+        CHECK(list.size() == 6);
+
+        list.appendRange(values.begin(), values.begin());
+        CHECK(list.size() == 6);
+
+        list.assign(values.rbegin(), values.rend());
+        CHECK(list.toString() == "[5, 4, 3, 2, 1]");
+        list.insertAtTail(0);
+        CHECK(list.get(5) == 0);
+    }
+
+    TEST_CASE("appendRange respects orientation and indexes")
+    {
+        DoublyLinkedList<string> list;
+        list.enableIndex();
+        list.enableHashIndex();
+        list.insertAtTail("a");
+        list.insertAtTail("b");
+        list.reverse(); // [b, a]
+        const char *more[] = {"c", "d", "e"};
+        list.appendRange(more, more + 3);
+        CHECK(list.toString() == "[b, a, c, d, e]");
+        CHECK(list.get(3) == "d");
+        CHECK(list.indexOf("e") == 4);
+        CHECK(list.contains("c"));
+        list.reverse();
+        CHECK(list.toString() == "[e, d, c, a, b]");
+    }
+
+    TEST_CASE("appendDelimited parses numbers, chars and strings")
+    {
+        DoublyLinkedList<int> ints;
+        std::istringstream intText("1\n-2\r\n 30 \n2147483647\n");
+        ints.appendDelimited(intText);
+        CHECK(ints.toString() == "[1, -2, 30, 2147483647]");
+
+        DoublyLinkedList<double> doubles;
+        std::istringstream doubleText("0.5,1e3,-2.25");
+        doubles.appendDelimited(doubleText, ',');
+        CHECK(doubles.toString() == "[0.5, 1000, -2.25]");
+
+        DoublyLinkedList<char> chars;
+        std::istringstream charText("a;b;;c");
+        CHECK_THROWS_AS(chars.appendDelimited(charText, ';'), std::runtime_error);
+        CHECK(chars.size() == 0);
+
+        DoublyLinkedList<string> words;
+        std::istringstream wordText("alpha||gamma|");
+        words.appendDelimited(wordText, '|');
+        CHECK(words.size() == 3);
+        CHECK(words.get(1).empty());
+        CHECK(words.get(2) == "gamma");
+    }
+
+    TEST_CASE("appendDelimited reads Points in the toString format")
+    {
+        DoublyLinkedList<Point> points;
+        std::istringstream text("(1,2,3)\n4 5 6\n( 0.5 , -1 )\n");
+        points.appendDelimited(text);
+        REQUIRE(points.size() == 3);
+        CHECK(points.get(0) == Point(1, 2, 3));
+        CHECK(points.get(1) == Point(4, 5, 6));
+        CHECK(points.get(2) == Point(0.5, -1));
+
+        std::istringstream bad("(1,2\n");
+        CHECK_THROWS_AS(points.appendDelimited(bad), std::runtime_error);
+        CHECK(points.size() == 3);
+    }
+
+    TEST_CASE("appendDelimited handles fields split across blocks")
+    {
+        std::string text;
+        for (int i = 0; i < 50000; ++i)
+            text += std::to_string(i * 7) + "\n";
+        std::istringstream in(text);
+        DoublyLinkedList<int> list;
+        list.appendDelimited(in);
+        REQUIRE(list.size() == 50000);
+        int i = 0;
+        bool ok = true;
+        for (int x : list)
+            ok = ok && x == 7 * i++;
+        CHECK(ok);
+
+        std::istringstream malformed("1\n2\nthree\n4\n");
+        CHECK_THROWS_AS(list.appendDelimited(malformed), std::runtime_error);
+        CHECK(list.size() == 50000);
+    }
+}
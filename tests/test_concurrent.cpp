@@ -0,0 +1,144 @@
+#include "doctest/doctest.h"
+#include "src/ConcurrentDoublyLinkedList.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("ConcurrentDoublyLinkedList")
+{
+    TEST_CASE("single-threaded behaviour matches DoublyLinkedList")
+    {
+        ConcurrentDoublyLinkedList<int> list;
+        CHECK(list.toString() == "[]");
+        list.insertAtTail(2);
+        list.insertAtHead(1);
+        list.insertAtTail(4);
+        list.insertAt(2, 3);
+        CHECK(list.toString() == "[1, 2, 3, 4]");
+        CHECK(list.size() == 4);
+        CHECK(list.get(0) == 1);
+        CHECK(list.get(3) == 4);
+        CHECK(list.contains(3));
+        list.deleteAt(0);
+        list.deleteAt(2);
+        CHECK(list.toString() == "[2, 3]");
+        CHECK_THROWS_AS(list.get(2), std::out_of_range);
+        CHECK_THROWS_AS(list.deleteAt(2), std::out_of_range);
+        CHECK_THROWS_AS(list.insertAt(3, 0), std::out_of_range);
+        CHECK_THROWS_AS(list.deleteAt(-1), std::out_of_range);
+        list.forEach([](int &x) { x *= 10; });
+        CHECK(list.toString() == "[20, 30]");
+        list.clear();
+        CHECK(list.size() == 0);
+        CHECK(list.toString() == "[]");
+    }
+
+    TEST_CASE("stress: inserts, deletes and walks from many threads")
+    {
+        const int THREADS = 8;
+        const int OPS = 4000;
+        ConcurrentDoublyLinkedList<int> list;
+        std::atomic<int> deleted(0);
+        std::atomic<bool> walkFailed(false);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            workers.emplace_back([&, t] {
+                unsigned seed = 12345u + t;
+                for (int i = 0; i < OPS; ++i)
+                {
+                    seed = seed * 1103515245u + 12345u;
+                    switch ((seed >> 16) % 6)
+                    {
+                    case 0:
+                    case 1:
+                        list.insertAtTail(t);
+                        break;
+                    case 2:
+                        list.insertAtHead(t);
+                        break;
+                    case 3:
+                        try
+                        {
+                            list.deleteAt(int((seed >> 8) % 8));
+                            ++deleted;
+                        }
+                        catch (const std::out_of_range &)
+                        {
+                        }
+                        break;
+                    case 4:
+                        try
+                        {
+                            list.insertAt(int((seed >> 8) % 4), t);
+                        }
+                        catch (const std::out_of_range &)
+                        {
+                            list.insertAtHead(t); // keep the insert count predictable
+                        }
+                        break;
+                    default:
+                    {
+                        int seen = 0;
+                        list.forEach([&](int &x) {
+                            if (x < 0 || x >= THREADS)
+                                walkFailed = true;
+                            ++seen;
+                        });
+                        break;
+                    }
+                    }
+                }
+            });
+        }
+        for (std::thread &w : workers)
+            w.join();
+
+        // Replay the same random choices to count the inserts
+        int inserted = 0;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            unsigned seed = 12345u + t;
+            for (int i = 0; i < OPS; ++i)
+            {
+                seed = seed * 1103515245u + 12345u;
+                int op = int((seed >> 16) % 6);
+                if (op <= 2 || op == 4)
+                    ++inserted;
+            }
+        }
+        CHECK_FALSE(walkFailed.load());
+        CHECK(list.size() == inserted - deleted.load());
+        int walked = 0;
+        list.forEach([&](int &) { ++walked; });
+        CHECK(walked == list.size());
+    }
+
+    TEST_CASE("stress: clear races with producers")
+    {
+        ConcurrentDoublyLinkedList<string> list;
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> producers;
+        for (int t = 0; t < 4; ++t)
+        {
+            producers.emplace_back([&] {
+                while (!stop)
+                {
+                    list.insertAtTail("tail");
+                    list.insertAtHead("head");
+                }
+            });
+        }
+        for (int i = 0; i < 50; ++i)
+            list.clear();
+        stop = true;
+        for (std::thread &p : producers)
+            p.join();
+        list.clear();
+        CHECK(list.size() == 0);
+        CHECK(list.toString() == "[]");
+        int walked = 0;
+        list.forEach([&](string &) { ++walked; });
+        CHECK(walked == list.size());
+    }
+}
@@ -0,0 +1,180 @@
+#include "doctest/doctest.h"
+#include "src/CowList.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("CowList")
+{
+    TEST_CASE("cow list basic operations")
+    {
+        CowList<int> list;
+        CHECK(list.empty());
+        CHECK(list.toString() == "[]");
+        list.insertAtTail(2);
+        list.insertAtHead(1);
+        list.insertAt(2, 4);
+        list.insertAt(2, 3);
+        CHECK(list.toString() == "[1, 2, 3, 4]");
+        CHECK(list.get(2) == 3);
+        CHECK(list.indexOf(4) == 3);
+        CHECK_FALSE(list.contains(9));
+        list.set(0, 0);
+        list.deleteAt(1);
+        CHECK(list.toString() == "[0, 3, 4]");
+        CHECK_THROWS_AS(list.get(3), std::out_of_range);
+        CHECK_THROWS_AS(list.insertAt(-1, 0), std::out_of_range);
+        CHECK_THROWS_AS(list.deleteAt(3), std::out_of_range);
+        list.clear();
+        CHECK(list.size() == 0);
+
+        CowList<string> words;
+        const char *source[] = {"a", "b", "c"};
+        words.appendRange(source, source + 3);
+        CHECK(words.toString() == "[a, b, c]");
+        CHECK(words.toString([](string &s) { return "<" + s + ">"; }) == "[<a>, <b>, <c>]");
+    }
+
+    TEST_CASE("cow list matches a vector across a random mix of edits")
+    {
+        CowList<int> list;
+        std::vector<int> model;
+        std::uint32_t seed = 11;
+        bool same = true;
+        for (int step = 0; step < 40000 && same; ++step)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int op = int(seed >> 28);
+            int size = int(model.size());
+            int pos = int((seed >> 8) % std::uint32_t(size + 1));
+            // Grow for the first half, then shrink back, so merges run at every level
+            if (size == 0 || (step < 20000 ? op < 10 : op < 5))
+            {
+                list.insertAt(pos, step);
+                model.insert(model.begin() + pos, step);
+            }
+            else if (op < 14)
+            {
+                pos %= size;
+                list.deleteAt(pos);
+                model.erase(model.begin() + pos);
+            }
+            else
+            {
+                pos %= size;
+                list.set(pos, -step);
+                model[pos] = -step;
+            }
+            if (step % 997 == 0)
+            {
+                int i = 0;
+                for (int value : list)
+                    same = same && value == model[i++];
+                same = same && i == int(model.size());
+            }
+        }
+        CHECK(same);
+        REQUIRE(list.size() == int(model.size()));
+        for (int i = 0; i < list.size(); i += 37)
+            CHECK(list.get(i) == model[i]);
+        if (!model.empty())
+            CHECK(list.indexOf(model.back()) == int(model.size()) - 1);
+
+        // Iterators step both ways across chunk boundaries
+        auto it = list.end();
+        for (int i = int(model.size()) - 1; i >= 0 && same; --i)
+            same = *--it == model[i];
+        CHECK(same);
+        CHECK(it == list.begin());
+    }
+
+    TEST_CASE("snapshots keep their contents while the list changes")
+    {
+        CowList<int> list;
+        for (int i = 0; i < 5000; ++i)
+            list.insertAtTail(i);
+        auto before = list.snapshot();
+        string expected = before.toString();
+
+        list.set(10, -1);
+        list.deleteAt(0);
+        list.insertAt(2500, 100000);
+        for (int i = 0; i < 1000; ++i)
+            list.insertAtHead(i);
+        auto middle = list.snapshot();
+        list.clear();
+
+        CHECK(before.size() == 5000);
+        CHECK(before.get(10) == 10);
+        CHECK(before.toString() == expected);
+        CHECK(middle.size() == 6000);
+        CHECK(middle.get(1000 + 9) == -1);
+        CHECK(middle.indexOf(100000) == 1000 + 2500);
+        CHECK(list.empty());
+
+        // Copies of a list share nodes too, and writes to one never reach the other
+        CowList<string> a;
+        a.insertAtTail("x");
+        CowList<string> b(a);
+        b.set(0, "y");
+        b.insertAtTail("z");
+        CHECK(a.toString() == "[x]");
+        CHECK(b.toString() == "[y, z]");
+        auto empty = CowList<Point>().snapshot();
+        CHECK(empty.begin() == empty.end());
+    }
+
+    TEST_CASE("readers iterate snapshots while one writer keeps editing")
+    {
+        // Each snapshot holds 0..n-1 in order, so a reader can verify it alone
+        CowList<int> list;
+        std::mutex latestLock;
+        CowList<int>::Snapshot latest = list.snapshot();
+        std::atomic<bool> done(false);
+        std::atomic<bool> consistent(true);
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 2; ++r)
+        {
+            readers.emplace_back([&] {
+                while (!done.load())
+                {
+                    CowList<int>::Snapshot view;
+                    {
+                        std::lock_guard<std::mutex> guard(latestLock);
+                        view = latest;
+                    }
+                    int expected = 0;
+                    for (int value : view)
+                    {
+                        if (value != expected++)
+                            consistent = false;
+                    }
+                    if (expected != view.size())
+                        consistent = false;
+                }
+            });
+        }
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            // Edits in the middle must not show through to published snapshots
+            int middle = list.size() / 2;
+            list.insertAt(middle, -1);
+            list.deleteAt(middle);
+            list.insertAtTail(i);
+            if (i % 64 == 0)
+            {
+                std::lock_guard<std::mutex> guard(latestLock);
+                latest = list.snapshot();
+            }
+        }
+        done = true;
+        for (auto &reader : readers)
+            reader.join();
+        CHECK(consistent.load());
+        CHECK(list.size() == 20000);
+    }
+}
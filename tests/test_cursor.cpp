@@ -0,0 +1,215 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("DoublyLinkedList Cursor")
+{
+    TEST_CASE("cursor moves, reads, inserts and erases")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 5; ++i)
+            list.insertAtTail(i * 10);
+
+        auto c = list.cursor(1);
+        CHECK(c.get() == 10);
+        c.moveNext().moveNext();
+        CHECK(c.position() == 3);
+        CHECK(c.get() == 30);
+        c.insert(25); // lands before the cursor, which stays on 30
+        CHECK(c.position() == 4);
+        CHECK(c.get() == 30);
+        c.erase(); // now on 40
+        CHECK(c.get() == 40);
+        c.get() = 41;
+        c.movePrev();
+        CHECK(c.get() == 25);
+        CHECK(list.toString() == "[0, 10, 20, 25, 41]");
+
+        c.moveTo(5);
+        CHECK(c.atEnd());
+        c.insert(50); // at the end this appends
+        CHECK(c.atEnd());
+        CHECK(c.position() == 6);
+        CHECK(list.toString() == "[0, 10, 20, 25, 41, 50]");
+    }
+
+    TEST_CASE("invalid moves and stale cursors throw cursor_error")
+    {
+        DoublyLinkedList<string> list;
+        list.insertAtTail("a");
+        list.insertAtTail("b");
+        auto c = list.cursor(0);
+        CHECK_THROWS_AS(c.movePrev(), cursor_error);
+        CHECK_THROWS_AS(c.moveTo(3), cursor_error);
+        CHECK_THROWS_AS(list.cursor(-1), cursor_error);
+        c.moveTo(2);
+        CHECK_THROWS_AS(c.moveNext(), cursor_error);
+        CHECK_THROWS_AS(c.get(), cursor_error);
+        CHECK_THROWS_AS(c.erase(), cursor_error);
+
+        auto other = list.cursor(1);
+        other.erase();
+        CHECK_THROWS_AS(c.position(), cursor_error); // list changed behind c's back
+        list.reverse();
+        CHECK_THROWS_AS(other.get(), cursor_error);
+
+        DoublyLinkedList<string> empty;
+        auto e = empty.cursor();
+        CHECK(e.atEnd());
+        e.insert("x");
+        CHECK(empty.toString() == "[x]");
+    }
+
+    TEST_CASE("cursor follows the logical order of a reversed list")
+    {
+        DoublyLinkedList<char> list;
+        for (char ch = 'a'; ch <= 'e'; ++ch)
+            list.insertAtTail(ch);
+        list.reverse();
+        auto c = list.cursor(0);
+        CHECK(c.get() == 'e');
+        c.moveNext();
+        c.insert('x');
+        c.moveNext();
+        CHECK(c.get() == 'c');
+        c.erase();
+        CHECK(list.toString() == "[e, x, d, b, a]");
+        c.movePrev();
+        CHECK(c.get() == 'd');
+    }
+
+    TEST_CASE("neighbouring index accesses reuse the last node reached")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 1000; ++i)
+            list.insertAtTail(i);
+        list.resetStats();
+        // Mixed local access around the middle; the cache must track every shift
+        long long sum = 0;
+        for (int i = 400; i < 600; i += 2)
+        {
+            sum += list.get(i) + list.get(i + 1);
+            list.insertAt(i + 2, -1);
+            list.deleteAt(i + 2);
+        }
+        CHECK(sum == (400LL + 599) * 200 / 2);
+#ifdef DLL_INSTRUMENT
+        // Only the first get walks from a sentinel; after that every step is 0 or 1 node
+        ListStats stats = list.stats();
+        CHECK(stats.walks[ListStats::GET].total == 400 + 100);
+        CHECK(stats.walks[ListStats::INSERT_AT].max == 1);
+        CHECK(stats.walks[ListStats::DELETE_AT].total == 0);
+#endif
+        list.insertAtHead(-5);                 // shifts every position
+        CHECK(list.get(600) == 599);
+        list.deleteAt(0);
+        CHECK(list.get(599) == 599);
+        list.deleteAt(599);                    // the cached node itself
+        CHECK(list.get(599) == 600);
+        list.insertAt(599, 77);                // before the cached node
+        CHECK(list.get(600) == 600);
+        CHECK(list.get(599) == 77);
+        list.reverse();
+        CHECK(list.get(999 - 599) == 77);
+        list.sort();
+        CHECK(list.get(0) == 0);
+        CHECK(list.get(999) == 999);
+
+        // The index and the cache agree, and short hops skip the index
+        DoublyLinkedList<int> indexed;
+        indexed.enableIndex();
+        for (int i = 0; i < 5000; ++i)
+            indexed.insertAtTail(i);
+        for (int i = 2500; i < 2600; ++i)
+            CHECK(indexed.get(i) == i);
+        indexed.deleteAt(2550);
+        CHECK(indexed.get(2550) == 2551);
+        CHECK(indexed.get(10) == 10);
+        CHECK(indexed.indexOf(4999) == 4998);
+    }
+
+    TEST_CASE("position cache survives a random mix of edits")
+    {
+        for (bool indexed : {false, true})
+        {
+            DoublyLinkedList<int> list;
+            if (indexed)
+                list.enableIndex();
+            std::vector<int> model;
+            std::uint32_t seed = 7;
+            bool same = true;
+            for (int step = 0; step < 20000 && same; ++step)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                int op = int(seed >> 28);
+                int size = int(model.size());
+                int pos = size ? int((seed >> 8) % std::uint32_t(size)) : 0;
+                if (op < 4 || size == 0)
+                {
+                    list.insertAt(pos, step);
+                    model.insert(model.begin() + pos, step);
+                }
+                else if (op < 7)
+                {
+                    list.deleteAt(pos);
+                    model.erase(model.begin() + pos);
+                }
+                else if (op == 7)
+                {
+                    list.insertAtHead(step);
+                    model.insert(model.begin(), step);
+                }
+                else if (op == 8)
+                {
+                    list.reverse();
+                    std::reverse(model.begin(), model.end());
+                }
+                else
+                {
+                    // Local reads next to the last position, the case the cache is for
+                    for (int d = -2; d <= 2; ++d)
+                    {
+                        int i = pos + d;
+                        if (i >= 0 && i < size)
+                            same = same && list.get(i) == model[i];
+                    }
+                }
+            }
+            CHECK(same);
+            CHECK(list.size() == int(model.size()));
+        }
+    }
+
+    TEST_CASE("const lookups read the position cache without moving it")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 1000; ++i)
+            list.insertAtTail(i);
+        CHECK(list.get(500) == 500); // non-const: the cache now sits on 500
+        list.resetStats();
+
+        const DoublyLinkedList<int> &view = list;
+        CHECK(view.get(900) == 900);
+        CHECK(view.get(501) == 501);
+#ifdef DLL_INSTRUMENT
+        // 99 steps from the tail, then 1 from the cache, which stayed on 500
+        CHECK(list.stats().walks[ListStats::GET].total == 99 + 1);
+#endif
+
+        // Const readers on several threads share the list safely (run under -fsanitize=thread)
+        std::vector<std::thread> readers;
+        std::vector<long long> sums(2, 0);
+        for (int r = 0; r < 2; ++r)
+        {
+            readers.emplace_back([&view, &sums, r] {
+                for (int i = r; i < 1000; i += 2)
+                    sums[r] += view.get(i);
+            });
+        }
+        for (auto &reader : readers)
+            reader.join();
+        CHECK(sums[0] + sums[1] == 999LL * 1000 / 2);
+    }
+}
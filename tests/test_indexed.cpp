@@ -0,0 +1,183 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include <vector>
+
+TEST_SUITE("DoublyLinkedList Indexed Mode")
+{
+    TEST_CASE("enable/disable on empty and filled lists")
+    {
+        DoublyLinkedList<int> list;
+        CHECK_FALSE(list.isIndexed());
+        list.enableIndex();
+        CHECK(list.isIndexed());
+        CHECK_THROWS_AS(list.get(0), std::out_of_range);
+
+        for (int i = 0; i < 10; ++i) list.insertAtTail(i);
+        CHECK(list.get(7) == 7);
+        list.disableIndex();
+        CHECK_FALSE(list.isIndexed());
+        CHECK(list.get(7) == 7);
+        list.enableIndex();                 // built from existing nodes
+        CHECK(list.get(3) == 3);
+    }
+
+    TEST_CASE("random inserts and deletes match a vector model")
+    {
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        std::vector<int> model;
+        unsigned state = 12345;
+        auto next = [&state]() { state = state * 1103515245u + 12345u; return int(state >> 8); };
+
+        for (int step = 0; step < 3000; ++step)
+        {
+            int op = next() % 4;
+            if (op < 2 || model.empty())
+            {
+                int pos = next() % (int(model.size()) + 1);
+                list.insertAt(pos, step);
+                model.insert(model.begin() + pos, step);
+            }
+            else if (op == 2)
+            {
+                int pos = next() % int(model.size());
+                list.deleteAt(pos);
+                model.erase(model.begin() + pos);
+            }
+            else
+            {
+                int pos = next() % int(model.size());
+                REQUIRE(list.get(pos) == model[pos]);
+            }
+        }
+        REQUIRE(list.size() == int(model.size()));
+        for (int i = 0; i < list.size(); ++i)
+            CHECK(list.get(i) == model[i]);
+    }
+
+    TEST_CASE("head/tail inserts, reverse and iteration keep the index in sync")
+    {
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        for (int i = 1; i <= 4; ++i) list.insertAtTail(i);   // [1,2,3,4]
+        list.insertAtHead(0);                                 // [0,1,2,3,4]
+        list.reverse();                                       // [4,3,2,1,0]
+        CHECK(list.get(0) == 4);
+        CHECK(list.get(4) == 0);
+        list.insertAt(2, 9);                                  // [4,3,9,2,1,0]
+        list.deleteAt(5);                                     // [4,3,9,2,1]
+
+        int expected[] = {4, 3, 9, 2, 1};
+        int idx = 0;
+        for (int x : list) CHECK(x == expected[idx++]);
+        CHECK(idx == 5);
+        for (int i = 0; i < 5; ++i) CHECK(list.get(i) == expected[i]);
+    }
+
+    TEST_CASE("copy, move and clear carry the index correctly")
+    {
+        DoublyLinkedList<std::string> src;
+        src.enableIndex();
+        for (const char *s : {"a","b","c"}) src.insertAtTail(s);
+
+        DoublyLinkedList<std::string> copy(src);
+        CHECK(copy.isIndexed());
+        copy.insertAt(1, "x");
+        CHECK(copy.get(1) == "x");
+        CHECK(src.get(1) == "b");
+
+        DoublyLinkedList<std::string> moved(std::move(copy));
+        CHECK(moved.isIndexed());
+        CHECK(moved.get(3) == "c");
+
+        DoublyLinkedList<std::string> assigned;
+        assigned.enableIndex();
+        for (const char *s : {"p","q","r","s","t"}) assigned.insertAtTail(s);
+        assigned = src;                                        // shrink
+        CHECK(assigned.get(2) == "c");
+        assigned.insertAt(3, "d");
+        CHECK(assigned.get(3) == "d");
+
+        assigned.clear();
+        assigned.insertAtTail("z");
+        CHECK(assigned.get(0) == "z");
+    }
+}
+
+TEST_SUITE("DoublyLinkedList Hash Index")
+{
+    TEST_CASE("contains and findNode follow inserts and deletes")
+    {
+        DoublyLinkedList<std::string> list;
+        list.enableHashIndex();
+        CHECK(list.isHashIndexed());
+        CHECK_FALSE(list.contains("a"));
+        CHECK(list.findNode("a") == list.end());
+
+        list.insertAtTail("a");
+        list.insertAtTail("b");
+        list.insertAtHead("c");
+        list.insertAt(1, "b");               // [c,b,a,b]
+        CHECK(list.contains("a"));
+        CHECK(*list.findNode("c") == "c");
+        CHECK(list.indexOf("b") == 1);       // linear fallback finds the first
+
+        list.deleteAt(1);                    // [c,a,b]
+        CHECK(list.contains("b"));
+        CHECK(list.indexOf("b") == 2);
+        list.deleteAt(2);                    // [c,a]
+        CHECK_FALSE(list.contains("b"));
+        CHECK(list.indexOf("b") == -1);
+
+        list.clear();
+        CHECK_FALSE(list.contains("c"));
+        list.disableHashIndex();
+        CHECK_FALSE(list.isHashIndexed());
+    }
+
+    TEST_CASE("indexOf combines the hash and position indexes")
+    {
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        list.enableHashIndex();
+        for (int i = 0; i < 200; ++i) list.insertAtTail(i % 20);
+        CHECK(list.indexOf(7) == 7);
+        list.deleteAt(7);
+        CHECK(list.indexOf(7) == 26);
+        list.insertAtHead(7);
+        CHECK(list.indexOf(7) == 0);
+        list.reverse();
+        CHECK(list.indexOf(19) == 0);
+        CHECK(list.indexOf(7) == 12);
+        CHECK(list.indexOf(999) == -1);
+    }
+
+    TEST_CASE("enabling on a filled list, copies and assignment")
+    {
+        DoublyLinkedList<char> list;
+        for (char c : {'x', 'y', 'z'}) list.insertAtTail(c);
+        list.enableHashIndex();
+        CHECK(list.contains('y'));
+
+        DoublyLinkedList<char> copy(list);
+        CHECK(copy.isHashIndexed());
+        copy.deleteAt(1);
+        CHECK_FALSE(copy.contains('y'));
+        CHECK(list.contains('y'));
+
+        DoublyLinkedList<char> other;
+        other.insertAtTail('q');
+        list = other;                        // values of reused nodes change
+        CHECK(list.contains('q'));
+        CHECK_FALSE(list.contains('x'));
+        CHECK_FALSE(list.contains('z'));
+    }
+
+    TEST_CASE("types without std::hash are rejected")
+    {
+        CHECK_FALSE(DoublyLinkedList<Point>::supportsHashIndex);
+        DoublyLinkedList<Point> list;
+        CHECK_THROWS_AS(list.enableHashIndex(), std::logic_error);
+        CHECK_FALSE(list.isHashIndexed());
+    }
+}
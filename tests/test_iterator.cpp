@@ -329,3 +329,82 @@ TEST_SUITE("DoublyLinkedList Iterator")
         CHECK(it1 == it2);          // back to first
     }
 }
+
+TEST_SUITE("DoublyLinkedList Iterator Editing")
+{
+    TEST_CASE("insert before an iterator returns the new element")
+    {
+        DoublyLinkedList<int> list;
+        auto it = list.insert(list.end(), 3);       // [3]
+        CHECK(*it == 3);
+        it = list.insert(it, 1);                     // [1,3]
+        ++it;
+        list.insert(it, 2);                          // [1,2,3]
+        CHECK(list.toString() == "[1, 2, 3]");
+        CHECK(list.size() == 3);
+    }
+
+    TEST_CASE("erase returns the following iterator")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 5; ++i) list.insertAtTail(i);
+        auto it = list.begin();
+        ++it;
+        it = list.erase(it);                         // [0,2,3,4]
+        CHECK(*it == 2);
+        auto last = list.end();
+        --last;
+        CHECK(list.erase(last) == list.end());       // [0,2,3]
+        CHECK(list.toString() == "[0, 2, 3]");
+        CHECK_THROWS_AS(list.erase(list.end()), std::out_of_range);
+
+        // erase everything with the usual loop
+        for (auto e = list.begin(); e != list.end();) e = list.erase(e);
+        CHECK(list.size() == 0);
+    }
+
+    TEST_CASE("emplace constructs in place")
+    {
+        DoublyLinkedList<Point> points;
+        points.emplace(points.end(), 1.0, 2.0);
+        points.emplace(points.begin(), 0.0, 0.0, 5.0);
+        CHECK(points.get(0) == Point(0, 0, 5));
+        CHECK(points.get(1) == Point(1, 2));
+
+        DoublyLinkedList<std::string> words;
+        auto w = words.emplace(words.end(), 3, 'x');
+        CHECK(*w == "xxx");
+    }
+
+    TEST_CASE("eraseIf removes matches in one pass and keeps indexes valid")
+    {
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        list.enableHashIndex();
+        for (int i = 0; i < 20; ++i) list.insertAtTail(i);
+        CHECK(list.eraseIf([](int x) { return x % 3 == 0; }) == 7);
+        CHECK(list.size() == 13);
+        CHECK(list.get(0) == 1);
+        CHECK(list.get(12) == 19);
+        CHECK_FALSE(list.contains(9));
+        CHECK(list.indexOf(10) == 6);
+        CHECK(list.eraseIf([](int) { return false; }) == 0);
+    }
+
+    TEST_CASE("editing through iterators of a reversed list")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 1; i <= 4; ++i) list.insertAtTail(i);
+        list.reverse();                              // [4,3,2,1]
+        auto it = list.begin();
+        ++it;                                        // at 3
+        it = list.insert(it, 9);                     // [4,9,3,2,1]
+        CHECK(*it == 9);
+        it = list.erase(++it);                       // erase 3 -> at 2
+        CHECK(*it == 2);
+        list.emplace(list.end(), 0);                 // [4,9,2,1,0]
+        CHECK(list.toString() == "[4, 9, 2, 1, 0]");
+        list.eraseIf([](int x) { return x == 9; });
+        CHECK(list.toString() == "[4, 2, 1, 0]");
+    }
+}
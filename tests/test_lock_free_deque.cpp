@@ -0,0 +1,187 @@
+#include "doctest/doctest.h"
+#include "src/EpochReclaimer.h"
+#include "src/LockFreeDeque.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("LockFreeDeque")
+{
+    TEST_CASE("single-threaded behaviour matches std::deque")
+    {
+        LockFreeDeque<int> deque;
+        std::deque<int> reference;
+        CHECK(deque.empty());
+        int out = -1;
+        CHECK_FALSE(deque.popFront(out));
+        CHECK_FALSE(deque.popBack(out));
+
+        unsigned seed = 7;
+        bool same = true;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            switch ((seed >> 16) % 4)
+            {
+            case 0:
+                deque.pushFront(i);
+                reference.push_front(i);
+                break;
+            case 1:
+                deque.pushBack(i);
+                reference.push_back(i);
+                break;
+            case 2:
+                if (deque.popFront(out) != !reference.empty())
+                    same = false;
+                else if (!reference.empty())
+                {
+                    same = same && out == reference.front();
+                    reference.pop_front();
+                }
+                break;
+            default:
+                if (deque.popBack(out) != !reference.empty())
+                    same = false;
+                else if (!reference.empty())
+                {
+                    same = same && out == reference.back();
+                    reference.pop_back();
+                }
+                break;
+            }
+        }
+        CHECK(same);
+        CHECK(deque.empty() == reference.empty());
+    }
+
+    TEST_CASE("strings are moved in and out, leftovers destroyed")
+    {
+        LockFreeDeque<string> deque;
+        string big(200, 'q');
+        deque.pushBack(std::move(big));
+        deque.pushFront(string(100, 'p'));
+        deque.pushBack("tail");
+        string out;
+        CHECK(deque.popFront(out));
+        CHECK(out == string(100, 'p'));
+        CHECK(deque.popBack(out));
+        CHECK(out == "tail");
+        // One element stays behind for the destructor to release
+    }
+
+    TEST_CASE("stress: every pushed value is popped exactly once")
+    {
+        const int PRODUCERS = 4;
+        const int CONSUMERS = 4;
+        const int PER_PRODUCER = 20000;
+        LockFreeDeque<int> deque;
+        std::vector<std::atomic<int>> seen(PRODUCERS * PER_PRODUCER);
+        for (std::atomic<int> &s : seen)
+            s = 0;
+        std::atomic<int> popped(0);
+        std::atomic<int> producersDone(0);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < PRODUCERS; ++p)
+        {
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < PER_PRODUCER; ++i)
+                {
+                    int value = p * PER_PRODUCER + i;
+                    if (i % 2)
+                        deque.pushBack(value);
+                    else
+                        deque.pushFront(value);
+                }
+                ++producersDone;
+            });
+        }
+        for (int c = 0; c < CONSUMERS; ++c)
+        {
+            threads.emplace_back([&, c] {
+                int value;
+                while (true)
+                {
+                    bool got = c % 2 ? deque.popBack(value) : deque.popFront(value);
+                    if (got)
+                    {
+                        seen[value].fetch_add(1);
+                        ++popped;
+                    }
+                    else if (producersDone == PRODUCERS && deque.empty())
+                    {
+                        break;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread &t : threads)
+            t.join();
+
+        CHECK(popped == PRODUCERS * PER_PRODUCER);
+        bool exactlyOnce = true;
+        for (std::atomic<int> &s : seen)
+            exactlyOnce = exactlyOnce && s == 1;
+        CHECK(exactlyOnce);
+        CHECK(deque.empty());
+    }
+
+    TEST_CASE("stress: slots are recycled while both ends are busy")
+    {
+        const int THREADS = 6;
+        const int ROUNDS = 30000;
+        LockFreeDeque<int> deque;
+        std::atomic<long long> poppedSum(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&, t] {
+                int out;
+                for (int i = 0; i < ROUNDS; ++i)
+                {
+                    if (t % 2)
+                        deque.pushBack(i);
+                    else
+                        deque.pushFront(i);
+                    if (i % 3 == 0 ? deque.popBack(out) : deque.popFront(out))
+                        poppedSum += out;
+                }
+            });
+        }
+        for (std::thread &t : threads)
+            t.join();
+
+        // Each thread pops at most as often as it pushes, so the deque ends
+        // up holding whatever was not popped during the run
+        int out;
+        long long restSum = 0;
+        while (deque.popFront(out))
+            restSum += out;
+        long long pushedSum = THREADS * (ROUNDS * (ROUNDS - 1LL) / 2);
+        CHECK(poppedSum + restSum == pushedSum);
+        CHECK(deque.empty());
+    }
+
+    TEST_CASE("a thread that sees many short-lived deques keeps a bounded record cache")
+    {
+        std::size_t before = EpochReclaimer::threadCacheSize();
+        std::size_t largest = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            LockFreeDeque<int> deque;
+            deque.pushBack(i);
+            int out = -1;
+            CHECK(deque.popFront(out));
+            CHECK(out == i);
+            largest = std::max(largest, EpochReclaimer::threadCacheSize());
+        }
+        // Entries for destroyed deques are pruned as the cache grows
+        CHECK(largest - before <= 64);
+    }
+}
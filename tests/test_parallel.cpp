@@ -0,0 +1,106 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include "src/ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+
+TEST_SUITE("DoublyLinkedList Parallel Algorithms")
+{
+    TEST_CASE("reduce and countIf agree with a serial walk")
+    {
+        ThreadPool pool(4);
+        DoublyLinkedList<double> list;
+        double serialSum = 0;
+        for (int i = 0; i < 100000; ++i)
+        {
+            list.insertAtTail(i * 0.5);
+            serialSum += i * 0.5;
+        }
+        double sum = list.parallelReduce(pool, 0.0, [](double a, double b) { return a + b; });
+        CHECK(sum == serialSum); // halves below 2^53 add exactly in any order
+        CHECK(list.parallelCountIf(pool, [](double x) { return x >= 25000; }) == 50000);
+
+        // Non-commutative op: segments must be combined in list order
+        DoublyLinkedList<string> words;
+        string expected = ">";
+        for (int i = 0; i < 9000; ++i)
+        {
+            words.insertAtTail(std::to_string(i % 10));
+            expected += std::to_string(i % 10);
+        }
+        CHECK(words.parallelReduce(pool, string(">"), [](const string &a, const string &b) { return a + b; }) == expected);
+    }
+
+    TEST_CASE("forEach and transform touch every element once, in either orientation")
+    {
+        ThreadPool pool(3);
+        DoublyLinkedList<Point> points;
+        for (int i = 0; i < 20000; ++i)
+            points.insertAtTail(Point(i, 0, 0));
+        points.reverse();
+        points.parallelTransform(pool, [](const Point &p) { return p + Point(0, 1, 0); });
+        std::atomic<int> visited(0);
+        points.parallelForEach(pool, [&](Point &p) {
+            p.translate(0, 0, 2);
+            visited.fetch_add(1);
+        });
+        CHECK(visited == 20000);
+        CHECK(points.get(0) == Point(19999, 1, 2));
+        CHECK(points.get(19999) == Point(0, 1, 2));
+    }
+
+    TEST_CASE("forEach and transform keep the hash index keyed by the new values")
+    {
+        ThreadPool pool(2);
+        DoublyLinkedList<int> list;
+        list.enableHashIndex();
+        for (int i = 0; i < 20000; ++i)
+            list.insertAtTail(i);
+        list.parallelTransform(pool, [](int x) { return x + 100000; });
+        CHECK_FALSE(list.contains(5));
+        CHECK(list.contains(100005));
+        CHECK(list.indexOf(119999) == 19999);
+        CHECK(*list.findNode(100000) == 100000);
+
+        list.parallelForEach(pool, [](int &x) { x = -x; });
+        CHECK_FALSE(list.contains(100005));
+        CHECK(list.indexOf(-100005) == 5);
+
+        // A throwing fn leaves the values it already wrote findable
+        CHECK_THROWS_AS(list.parallelForEach(pool, [](int &x) {
+            if (x == -110000)
+                throw std::runtime_error("stop");
+            x = 0;
+        }), std::runtime_error);
+        CHECK(list.indexOf(-110000) == 10000);
+        CHECK(list.contains(0) == (list.countOf(0) > 0));
+        CHECK(list.contains(-100001) == (list.countOf(-100001) > 0));
+    }
+
+    TEST_CASE("split points come from the position index when enabled")
+    {
+        ThreadPool pool(2);
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        for (int i = 0; i < 50000; ++i)
+            list.insertAtTail(i);
+        long total = list.parallelReduce(pool, 0L, [](long a, long b) { return a + b; });
+        CHECK(total == 50000L * 49999 / 2);
+        CHECK(list.parallelCountIf(pool, [](int x) { return x % 2 == 0; }) == 25000);
+    }
+
+    TEST_CASE("empty and tiny lists")
+    {
+        ThreadPool pool(2);
+        DoublyLinkedList<int> empty;
+        CHECK(empty.parallelReduce(pool, 7, [](int a, int b) { return a + b; }) == 7);
+        CHECK(empty.parallelCountIf(pool, [](int) { return true; }) == 0);
+        int calls = 0;
+        empty.parallelForEach(pool, [&](int &) { ++calls; });
+        CHECK(calls == 0);
+
+        DoublyLinkedList<int> one;
+        one.insertAtTail(5);
+        CHECK(one.parallelReduce(pool, 1, [](int a, int b) { return a * b; }) == 5);
+    }
+}
@@ -0,0 +1,81 @@
+#include "doctest/doctest.h"
+#include "src/SimdSearch.h"
+#include "src/UnrolledLinkedList.h"
+#include "src/DoublyLinkedList.h"
+#include <cmath>
+#include <vector>
+
+TEST_SUITE("SimdSearch")
+{
+    TEST_CASE("vector kernels agree with the scalar loop at every length and offset")
+    {
+        std::vector<int> ints(100);
+        std::vector<char> chars(100);
+        std::vector<double> doubles(100);
+        for (int i = 0; i < 100; ++i)
+        {
+            ints[i] = i % 7;
+            chars[i] = char('a' + i % 5);
+            doubles[i] = (i % 3) * 0.5;
+        }
+        int needles[] = {3, 6};
+        for (int start = 0; start < 8; ++start)
+        {
+            for (int n = 0; n + start <= 100; n += 3)
+            {
+                const int *p = ints.data() + start;
+                REQUIRE(SimdSearch::findFirst(p, n, 6) == SimdSearch::findFirst<int>(p, n, 6));
+                REQUIRE(SimdSearch::count(p, n, 2) == SimdSearch::count<int>(p, n, 2));
+                REQUIRE(SimdSearch::findFirstAny(p, n, needles, 2) == SimdSearch::findFirstAny<int>(p, n, needles, 2));
+
+                const char *c = chars.data() + start;
+                REQUIRE(SimdSearch::findFirst(c, n, 'e') == SimdSearch::findFirst<char>(c, n, 'e'));
+                REQUIRE(SimdSearch::count(c, n, 'b') == SimdSearch::count<char>(c, n, 'b'));
+
+                const double *d = doubles.data() + start;
+                REQUIRE(SimdSearch::findFirst(d, n, 1.0) == SimdSearch::findFirst<double>(d, n, 1.0));
+                REQUIRE(SimdSearch::count(d, n, 0.5) == SimdSearch::count<double>(d, n, 0.5));
+            }
+        }
+        CHECK(std::string(SimdSearch::isa()).size() > 0);
+    }
+
+    TEST_CASE("floating point matches operator== for NaN and signed zero")
+    {
+        float values[9] = {1, 2, 3, 4, 5, 6, 7, -0.0f, std::nanf("")};
+        CHECK(SimdSearch::findFirst(values, 9, 0.0f) == 7);
+        CHECK(SimdSearch::findFirst(values, 9, std::nanf("")) == -1);
+        CHECK(SimdSearch::count(values, 9, 0.0f) == 1);
+    }
+
+    TEST_CASE("countOf and indexOfAny on both list layouts")
+    {
+        UnrolledLinkedList<int> unrolled;
+        DoublyLinkedList<int> plain;
+        for (int i = 0; i < 1000; ++i)
+        {
+            unrolled.insertAtTail(i % 10);
+            plain.insertAtTail(i % 10);
+        }
+        CHECK(unrolled.countOf(3) == 100);
+        CHECK(plain.countOf(3) == 100);
+        CHECK(unrolled.countOf(42) == 0);
+
+        int wanted[] = {42, 7, 5};
+        CHECK(unrolled.indexOfAny(wanted, 3) == 5);
+        CHECK(plain.indexOfAny(wanted, 3) == 5);
+        CHECK(unrolled.indexOfAny(wanted, 1) == -1);
+        CHECK(plain.indexOfAny(wanted, 0) == -1);
+
+        unrolled.deleteAt(5);
+        CHECK(unrolled.indexOf(5) == 14);
+        CHECK(unrolled.contains(9));
+
+        UnrolledLinkedList<std::string> words;
+        words.insertAtTail("x");
+        words.insertAtTail("y");
+        std::string any[] = {"z", "y"};
+        CHECK(words.indexOfAny(any, 2) == 1);
+        CHECK(words.countOf("x") == 1);
+    }
+}
@@ -0,0 +1,110 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include "src/ThreadPool.h"
+#include <cstdint>
+
+TEST_SUITE("DoublyLinkedList Sort")
+{
+    TEST_CASE("sort orders elements and keeps equal ones in their original order")
+    {
+        DoublyLinkedList<Point> points;
+        for (int i = 0; i < 1000; ++i)
+            points.insertAtTail(Point((i * 7) % 10, i, 0));
+        points.sort([](const Point &a, const Point &b) { return a.getX() < b.getX(); });
+
+        REQUIRE(points.size() == 1000);
+        Point last = points.get(0);
+        for (int i = 1; i < 1000; ++i)
+        {
+            Point p = points.get(i);
+            CHECK(last.getX() <= p.getX());
+            if (last.getX() == p.getX())
+                CHECK(last.getY() < p.getY()); // insertion order survives among equal keys
+            last = p;
+        }
+
+        // prev links were repaired: walking backwards gives the mirror order
+        auto it = points.end();
+        --it;
+        CHECK((*it).getX() == 9);
+        CHECK((*it).getY() == 997);
+    }
+
+    TEST_CASE("sort handles tiny, reversed and custom-ordered lists")
+    {
+        DoublyLinkedList<int> empty;
+        empty.sort();
+        CHECK(empty.toString() == "[]");
+        DoublyLinkedList<int> one;
+        one.insertAtTail(5);
+        one.sort();
+        CHECK(one.toString() == "[5]");
+
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 10; ++i)
+            list.insertAtTail(i % 4);
+        list.reverse();
+        list.sort();
+        CHECK(list.toString() == "[0, 0, 0, 1, 1, 1, 2, 2, 3, 3]");
+        list.insertAtHead(9);
+        list.insertAtTail(-1);
+        CHECK(list.toString() == "[9, 0, 0, 0, 1, 1, 1, 2, 2, 3, 3, -1]");
+
+        DoublyLinkedList<string> words;
+        for (const char *w : {"pear", "fig", "apple", "kiwi", "date"})
+            words.insertAtTail(w);
+        words.sort(std::greater<string>());
+        CHECK(words.toString() == "[pear, kiwi, fig, date, apple]");
+        words.reverse();
+        CHECK(words.toString() == "[apple, date, fig, kiwi, pear]");
+    }
+
+    TEST_CASE("sort keeps the position and hash indexes valid")
+    {
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        list.enableHashIndex();
+        for (int i = 0; i < 5000; ++i)
+            list.insertAtTail(4999 - i);
+        list.sort();
+        for (int i = 0; i < 5000; i += 499)
+            CHECK(list.get(i) == i);
+        CHECK(list.indexOf(1234) == 1234);
+        CHECK(list.contains(4999));
+        list.deleteAt(0);
+        CHECK(list.get(0) == 1);
+    }
+
+    TEST_CASE("parallelSort matches the serial sort")
+    {
+        ThreadPool pool(4);
+        DoublyLinkedList<int> serial;
+        DoublyLinkedList<int> parallel;
+        std::uint32_t seed = 12345;
+        for (int i = 0; i < 200000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            serial.insertAtTail(int(seed >> 12) % 1000);
+            parallel.insertAtTail(int(seed >> 12) % 1000);
+        }
+        parallel.reverse();
+        serial.reverse();
+        serial.sort();
+        parallel.parallelSort(pool);
+        REQUIRE(parallel.size() == 200000);
+        auto a = serial.begin();
+        bool same = true;
+        for (auto b = parallel.begin(); b != parallel.end(); ++a, ++b)
+            same = same && *a == *b;
+        CHECK(same);
+        CHECK(parallel.get(199999) == serial.get(199999));
+
+        DoublyLinkedList<Point> points;
+        for (int i = 0; i < 100000; ++i)
+            points.insertAtTail(Point(i % 3, i, 0));
+        points.parallelSort(pool, [](const Point &a, const Point &b) { return a.getX() < b.getX(); });
+        CHECK(points.get(0) == Point(0, 0, 0));
+        CHECK(points.get(33334) == Point(1, 1, 0));
+        CHECK(points.get(99999) == Point(2, 99998, 0));
+    }
+}
@@ -0,0 +1,144 @@
+#include "doctest/doctest.h"
+#include "src/SortedDoublyLinkedList.h"
+
+TEST_SUITE("SortedDoublyLinkedList")
+{
+    TEST_CASE("insert keeps order, with and without the index")
+    {
+        for (bool indexed : {true, false})
+        {
+            SortedDoublyLinkedList<int> list(std::less<int>(), indexed);
+            for (int v : {5, 1, 9, 3, 7, 3, 10, 0})
+                list.insert(v);
+            CHECK(list.toString() == "[0, 1, 3, 3, 5, 7, 9, 10]");
+            CHECK(list.contains(7));
+            CHECK_FALSE(list.contains(4));
+            CHECK(*list.lowerBound(3) == 3);
+            CHECK(*list.upperBound(3) == 5);
+            CHECK(list.lowerBound(11) == list.end());
+            CHECK(list.upperBound(-1) == list.begin());
+            CHECK(list.remove(3));
+            CHECK_FALSE(list.remove(4));
+            CHECK(list.toString() == "[0, 1, 3, 5, 7, 9, 10]");
+        }
+    }
+
+    TEST_CASE("equal elements keep insertion order and unique keeps the first")
+    {
+        auto byX = [](const Point &a, const Point &b) { return a.getX() < b.getX(); };
+        SortedDoublyLinkedList<Point, decltype(byX)> points(byX);
+        for (int i = 0; i < 12; ++i)
+            points.insert(Point(i % 3, i));
+        CHECK(points.get(0) == Point(0, 0));
+        CHECK(points.get(3) == Point(0, 9));
+        CHECK(points.get(4) == Point(1, 1));
+        CHECK(*points.lowerBound(Point(2, -1)) == Point(2, 2));
+        CHECK(points.unique() == 9);
+        CHECK(points.size() == 3);
+        CHECK(points.get(1) == Point(1, 1));
+        CHECK(points.get(2) == Point(2, 2));
+    }
+
+    TEST_CASE("hinted insert is exact next to the hint and still correct far from it")
+    {
+        for (bool indexed : {true, false})
+        {
+            SortedDoublyLinkedList<string> words(std::less<string>(), indexed);
+            auto hint = words.insert("m");
+            hint = words.insert(hint, "k");   // right before the hint
+            hint = words.insert(hint, "l");   // right after the hint
+            words.insert(hint, "z");          // far after
+            words.insert(words.end(), "a");   // far before
+            words.insert(words.begin(), "l"); // equal goes after the existing "l"
+            CHECK(words.toString() == "[a, k, l, l, m, z]");
+            auto second = words.upperBound("k");
+            ++second;
+            CHECK(*second == "l");
+            ++second;
+            CHECK(second == words.lowerBound("m"));
+        }
+    }
+
+    TEST_CASE("a hint one step off either way costs a constant number of comparisons")
+    {
+        struct CountingLess
+        {
+            int *count;
+            bool operator()(int a, int b) const
+            {
+                ++*count;
+                return a < b;
+            }
+        };
+        for (bool indexed : {true, false})
+        {
+            int count = 0;
+            SortedDoublyLinkedList<int, CountingLess> list(CountingLess{&count}, indexed);
+            for (int i = 0; i < 1000; ++i)
+                list.insert(i * 10);
+            auto at510 = list.lowerBound(510);
+            auto at500 = list.lowerBound(500);
+
+            count = 0;
+            list.insert(at510, 495); // belongs before 500: the hint is one past the slot
+            CHECK(count <= 3);
+            count = 0;
+            list.insert(at510, 505); // right before the hint
+            CHECK(count <= 2);
+            count = 0;
+            list.insert(at500, 503); // one after the hint: between 500 and 505
+            CHECK(count <= 3);
+
+            auto it = list.lowerBound(490);
+            for (int expected : {490, 495, 500, 503, 505, 510})
+                CHECK(*it++ == expected);
+            CHECK(list.size() == 1003);
+        }
+    }
+
+    TEST_CASE("mergeSorted relinks both lists in order and empties the source")
+    {
+        SortedDoublyLinkedList<double> a;
+        SortedDoublyLinkedList<double> b(std::less<double>(), false);
+        for (int i = 0; i < 1000; ++i)
+        {
+            a.insert(i * 2.0);
+            b.insert(i * 3.0);
+        }
+        a.mergeSorted(b);
+        CHECK(b.size() == 0);
+        REQUIRE(a.size() == 2000);
+        double last = -1;
+        bool ordered = true;
+        for (double v : a)
+        {
+            ordered = ordered && last <= v;
+            last = v;
+        }
+        CHECK(ordered);
+        CHECK(a.get(1999) == 2997.0);
+        CHECK(*a.lowerBound(6.0) == 6.0);
+        CHECK(a.unique() == 334); // multiples of 6 up to 1998 appeared twice
+        CHECK(a.size() == 1666);
+
+        SortedDoublyLinkedList<double> empty;
+        empty.mergeSorted(a);
+        CHECK(empty.size() == 1666);
+        CHECK(a.size() == 0);
+    }
+
+    TEST_CASE("partitionPoint follows the logical order of a reversed list")
+    {
+        DoublyLinkedList<int> list;
+        list.enableIndex();
+        for (int i = 0; i < 100; ++i)
+            list.insertAtHead(i);
+        list.reverse(); // logically 0..99 again, physically descending
+        auto it = list.partitionPoint([](int x) { return x < 42; });
+        CHECK(*it == 42);
+        CHECK(list.partitionPoint([](int) { return true; }) == list.end());
+        CHECK(list.partitionPoint([](int) { return false; }) == list.begin());
+        list.disableIndex();
+        CHECK(*list.partitionPoint([](int x) { return x < 42; }) == 42);
+    }
+}
@@ -0,0 +1,196 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include <vector>
+
+TEST_SUITE("DoublyLinkedList Splice/Append/Split")
+{
+    static void fill(DoublyLinkedList<int> &list, int from, int to)
+    {
+        for (int i = from; i <= to; ++i) list.insertAtTail(i);
+    }
+
+    static DoublyLinkedList<int>::Iterator at(const DoublyLinkedList<int> &list, int n)
+    {
+        auto it = list.begin();
+        while (n-- > 0) ++it;
+        return it;
+    }
+
+    TEST_CASE("append moves every node and leaves the source empty")
+    {
+        DoublyLinkedList<int> a, b;
+        fill(a, 1, 3);
+        fill(b, 4, 6);
+        int *moved = &b.get(0);
+        a.append(std::move(b));
+        CHECK(a.toString() == "[1, 2, 3, 4, 5, 6]");
+        CHECK(a.size() == 6);
+        CHECK(&a.get(3) == moved);          // relinked, not copied
+        CHECK(b.size() == 0);
+        CHECK(b.begin() == b.end());
+
+        b.insertAtTail(7);                  // source still usable
+        a.append(std::move(b));
+        a.append(DoublyLinkedList<int>());
+        CHECK(a.toString() == "[1, 2, 3, 4, 5, 6, 7]");
+    }
+
+    TEST_CASE("splice a partial range between lists")
+    {
+        DoublyLinkedList<int> a, b;
+        fill(a, 1, 3);                      // [1,2,3]
+        fill(b, 10, 14);                    // [10..14]
+        a.splice(at(a, 1), b, at(b, 1), at(b, 4));
+        CHECK(a.toString() == "[1, 11, 12, 13, 2, 3]");
+        CHECK(b.toString() == "[10, 14]");
+        CHECK(a.size() == 6);
+        CHECK(b.size() == 2);
+
+        a.splice(a.end(), b, b.begin(), b.end());
+        CHECK(a.toString() == "[1, 11, 12, 13, 2, 3, 10, 14]");
+        CHECK(b.size() == 0);
+
+        a.splice(a.begin(), b, b.begin(), b.end());   // empty range
+        CHECK(a.size() == 8);
+    }
+
+    TEST_CASE("splice inside one list")
+    {
+        DoublyLinkedList<int> list;
+        fill(list, 1, 6);
+        list.splice(list.begin(), list, at(list, 3), list.end());
+        CHECK(list.toString() == "[4, 5, 6, 1, 2, 3]");
+        CHECK(list.size() == 6);
+        list.splice(at(list, 3), list, at(list, 3), at(list, 4));  // no-op
+        CHECK(list.toString() == "[4, 5, 6, 1, 2, 3]");
+
+        list.reverse();                                             // [3,2,1,6,5,4]
+        list.splice(list.end(), list, list.begin(), at(list, 2));
+        CHECK(list.toString() == "[1, 6, 5, 4, 3, 2]");
+    }
+
+    TEST_CASE("splice between lists of opposite orientation")
+    {
+        DoublyLinkedList<int> a, b;
+        fill(a, 1, 4);
+        fill(b, 5, 8);
+        b.reverse();                                    // [8,7,6,5]
+        a.splice(at(a, 2), b, at(b, 1), at(b, 3));      // move [7,6]
+        CHECK(a.toString() == "[1, 2, 7, 6, 3, 4]");
+        CHECK(b.toString() == "[8, 5]");
+
+        a.reverse();                                    // [4,3,6,7,2,1]
+        b.append(std::move(a));
+        CHECK(b.toString() == "[8, 5, 4, 3, 6, 7, 2, 1]");
+        b.insertAtTail(0);
+        b.insertAtHead(9);
+        CHECK(b.toString() == "[9, 8, 5, 4, 3, 6, 7, 2, 1, 0]");
+        for (int i = 0; i < b.size(); ++i) b.get(i);
+
+        auto it = b.end();
+        --it;
+        CHECK(*it == 0);
+    }
+
+    TEST_CASE("splitAt cuts the tail into a new list")
+    {
+        DoublyLinkedList<int> list;
+        fill(list, 1, 5);
+        DoublyLinkedList<int> rest = list.splitAt(at(list, 2));
+        CHECK(list.toString() == "[1, 2]");
+        CHECK(rest.toString() == "[3, 4, 5]");
+        CHECK(rest.size() == 3);
+
+        DoublyLinkedList<int> none = list.splitAt(list.end());
+        CHECK(none.size() == 0);
+        DoublyLinkedList<int> all = list.splitAt(list.begin());
+        CHECK(list.size() == 0);
+        CHECK(all.toString() == "[1, 2]");
+
+        rest.reverse();                             // [5,4,3]
+        DoublyLinkedList<int> last = rest.splitAt(at(rest, 1));
+        CHECK(rest.toString() == "[5]");
+        CHECK(last.toString() == "[4, 3]");
+        last.insertAtTail(2);
+        CHECK(last.toString() == "[4, 3, 2]");
+    }
+
+    TEST_CASE("nodes stay valid when lists sharing a pool die in any order")
+    {
+        DoublyLinkedList<std::string> *a = new DoublyLinkedList<std::string>();
+        DoublyLinkedList<std::string> *b = new DoublyLinkedList<std::string>();
+        DoublyLinkedList<std::string> c;
+        for (int i = 0; i < 50; ++i) a->insertAtTail("a" + std::to_string(i));
+        for (int i = 0; i < 50; ++i) b->insertAtTail("b" + std::to_string(i));
+        c.insertAtTail("c");
+
+        b->splice(b->begin(), *a, a->begin(), a->end());
+        c.append(std::move(*b));
+        delete a;
+        delete b;
+        CHECK(c.size() == 101);
+        CHECK(c.get(1) == "a0");
+        CHECK(c.get(100) == "b49");
+        c.deleteAt(1);
+        c.insertAtTail("z");
+        CHECK(c.get(100) == "z");
+
+        DoublyLinkedList<int> x, y;
+        fill(x, 1, 100);
+        DoublyLinkedList<int> *z = new DoublyLinkedList<int>(x.splitAt(at(x, 50)));
+        y.append(std::move(*z));
+        delete z;
+        x.clear();
+        CHECK(y.get(49) == 100);
+    }
+
+    TEST_CASE("a long run of splices keeps every list's pool usable")
+    {
+        // Each splice joins the next list's pool with all earlier ones; without
+        // union by rank and path compression this builds a forwarding chain
+        // as long as the run that every allocation in lists[0] would walk
+        const int LISTS = 2000;
+        std::vector<DoublyLinkedList<int>> lists(LISTS);
+        for (int i = 0; i < LISTS; ++i)
+            lists[i].insertAtTail(i);
+        for (int i = 0; i + 1 < LISTS; ++i)
+            lists[i + 1].splice(lists[i + 1].begin(), lists[i], lists[i].begin(), lists[i].end());
+        CHECK(lists[LISTS - 1].size() == LISTS);
+        CHECK(lists[LISTS - 1].get(0) == 0);
+        CHECK(lists[LISTS - 1].get(LISTS - 1) == LISTS - 1);
+
+        for (int i = 0; i < LISTS; ++i)
+            lists[i].insertAtTail(-i);
+        CHECK(lists[0].toString() == "[0]");
+        CHECK(lists[LISTS - 1].size() == LISTS + 1);
+        // Free in an order unrelated to the joins; every node must still be valid
+        for (int i = 0; i < LISTS - 1; i += 2)
+            lists[i] = DoublyLinkedList<int>();
+        lists[LISTS - 1].deleteAt(0);
+        lists[LISTS - 1].insertAtHead(7);
+        CHECK(lists[LISTS - 1].get(0) == 7);
+        CHECK(lists[1].toString() == "[-1]");
+    }
+
+    TEST_CASE("indexes are rebuilt after relinking")
+    {
+        DoublyLinkedList<int> a, b;
+        a.enableIndex();
+        a.enableHashIndex();
+        b.enableHashIndex();
+        fill(a, 1, 5);
+        fill(b, 6, 9);
+        a.splice(at(a, 1), b, b.begin(), at(b, 2));     // [1,6,7,2,3,4,5]
+        CHECK(a.get(2) == 7);
+        CHECK(a.indexOf(7) == 2);
+        CHECK(a.contains(6));
+        CHECK_FALSE(b.contains(6));
+        CHECK(b.contains(8));
+
+        DoublyLinkedList<int> rest = a.splitAt(at(a, 4));
+        CHECK(rest.isIndexed());
+        CHECK(rest.get(1) == 4);
+        CHECK_FALSE(a.contains(5));
+        CHECK(rest.indexOf(5) == 2);
+    }
+}
@@ -0,0 +1,155 @@
+#include "doctest/doctest.h"
+#include "src/DoublyLinkedList.h"
+#include "src/ThreadPool.h"
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+
+// Run the whole suite with -DDLL_INSTRUMENT (or -DDLL_INSTRUMENT_LATENCY) on
+// every file to exercise the counters; a plain build checks they stay off.
+TEST_SUITE("DoublyLinkedList Instrumentation")
+{
+    TEST_CASE("stats are off without DLL_INSTRUMENT and count every call with it")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 100; ++i)
+            list.insertAtTail(i);
+        list.insertAtHead(-1);
+        list.insertAt(50, 7);
+        CHECK(list.get(90) == 88);
+        CHECK(list.get(10) == 9);
+        list.deleteAt(0);
+        CHECK(list.contains(42));
+        list.reverse();
+
+        ListStats stats = list.stats();
+#ifdef DLL_INSTRUMENT
+        REQUIRE(stats.enabled);
+        CHECK(stats.calls[ListStats::INSERT_AT_TAIL] == 100);
+        CHECK(stats.calls[ListStats::INSERT_AT_HEAD] == 1);
+        CHECK(stats.calls[ListStats::INSERT_AT] == 1);
+        CHECK(stats.calls[ListStats::GET] == 2);
+        CHECK(stats.calls[ListStats::DELETE_AT] == 1);
+        CHECK(stats.calls[ListStats::CONTAINS] == 1);
+        CHECK(stats.calls[ListStats::INDEX_OF] == 1); // contains runs indexOf
+        CHECK(stats.calls[ListStats::REVERSE] == 1);
+        CHECK(stats.nodesAllocated == 102);
+        CHECK(stats.nodesFreed == 1);
+
+        // Walks start from the nearer end: 50 for insertAt, 11 and 10 for the gets, 0 for deleteAt(0)
+        CHECK(stats.walks[ListStats::INSERT_AT].max == 50);
+        CHECK(stats.walks[ListStats::GET].count == 2);
+        CHECK(stats.walks[ListStats::GET].total == 21);
+        CHECK(stats.walks[ListStats::DELETE_AT].total == 0);
+        CHECK(stats.walks[ListStats::INDEX_OF].count == 0);
+        CHECK(stats.toString().find("insertAt ") != string::npos);
+#ifdef DLL_INSTRUMENT_LATENCY
+        CHECK(stats.latencyEnabled);
+        CHECK(stats.ticks[ListStats::GET].count == 2);
+        CHECK(stats.ticks[ListStats::INDEX_OF].count == 0); // charged to contains
+#endif
+
+        DoublyLinkedList<int> copy(list);
+        CHECK(copy.stats().calls[ListStats::GET] == 0);
+        list.resetStats();
+        CHECK(list.stats().calls[ListStats::INSERT_AT_TAIL] == 0);
+        CHECK(list.stats().enabled);
+#else
+        CHECK_FALSE(stats.enabled);
+        CHECK(stats.calls[ListStats::INSERT_AT_TAIL] == 0);
+        CHECK(stats.nodesAllocated == 0);
+        CHECK(stats.toString().find("disabled") != string::npos);
+#endif
+    }
+
+    TEST_CASE("every public operation is counted")
+    {
+        ThreadPool pool(2);
+        DoublyLinkedList<int> list;
+        const int values[] = {5, 3, 3, 8, 1};
+        list.assign(values, values + 5);
+        list.appendRange(values, values + 2);
+        std::istringstream in("4,9");
+        list.appendDelimited(in, ',');
+        CHECK(list.findNode(8) != list.end());
+        CHECK(list.countOf(3) == 3);
+        const int any[] = {9, 8};
+        CHECK(list.indexOfAny(any, 2) == 3);
+        list.cursor(2);
+        list.parallelForEach(pool, [](int &value) { value += 0; });
+        list.parallelTransform(pool, [](int value) { return value; });
+        CHECK(list.parallelReduce(pool, 0, std::plus<int>()) == 41);
+        CHECK(list.parallelCountIf(pool, [](int value) { return value == 3; }) == 3);
+        list.parallelSort(pool);
+        CHECK(list.unique() == 3);
+        CHECK(list.eraseIf([](int value) { return value > 8; }) == 1);
+        DoublyLinkedList<int> other;
+        other.insertAtTail(2);
+        list.merge(other);
+        CHECK(*list.partitionPoint([](int value) { return value < 4; }) == 4);
+
+        string path = (std::filesystem::temp_directory_path() / "dll_stats.bin").string();
+        list.saveBinary(path);
+        DoublyLinkedList<int> loaded = DoublyLinkedList<int>::loadBinary(path);
+        std::remove(path.c_str());
+        CHECK(loaded.toString() == list.toString());
+
+#ifdef DLL_INSTRUMENT
+        ListStats stats = list.stats();
+        CHECK(stats.calls[ListStats::ASSIGN] == 1);
+        CHECK(stats.calls[ListStats::APPEND_RANGE] == 2); // one inside assign
+        CHECK(stats.calls[ListStats::APPEND_DELIMITED] == 1);
+        CHECK(stats.calls[ListStats::FIND_NODE] == 1);
+        CHECK(stats.calls[ListStats::COUNT_OF] == 1);
+        CHECK(stats.calls[ListStats::INDEX_OF_ANY] == 1);
+        CHECK(stats.calls[ListStats::CURSOR] == 1);
+        CHECK(stats.calls[ListStats::PARALLEL_FOR_EACH] == 2); // one inside parallelTransform
+        CHECK(stats.calls[ListStats::PARALLEL_TRANSFORM] == 1);
+        CHECK(stats.calls[ListStats::PARALLEL_REDUCE] == 1);
+        CHECK(stats.calls[ListStats::PARALLEL_COUNT_IF] == 1);
+        CHECK(stats.calls[ListStats::PARALLEL_SORT] == 1);
+        CHECK(stats.calls[ListStats::SORT] == 1); // short lists fall back to sort
+        CHECK(stats.calls[ListStats::UNIQUE] == 1);
+        CHECK(stats.calls[ListStats::ERASE_IF] == 1);
+        CHECK(stats.calls[ListStats::MERGE] == 1);
+        CHECK(stats.calls[ListStats::PARTITION_POINT] == 1);
+        CHECK(stats.calls[ListStats::SAVE_BINARY] == 1);
+        CHECK(loaded.stats().calls[ListStats::LOAD_BINARY] == 1);
+        CHECK(stats.toString().find("parallelTransform ") != string::npos);
+#endif
+    }
+
+    TEST_CASE("indexed lookups record their descent depth as the walk")
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 4096; ++i)
+            list.insertAtTail(i);
+        list.enableIndex();
+        const DoublyLinkedList<int> &view = list;
+        CHECK(view.get(2000) == 2000);
+        CHECK(view.get(1000) == 1000);
+#ifdef DLL_INSTRUMENT
+        ListStats stats = list.stats();
+        REQUIRE(stats.walks[ListStats::GET].count == 2);
+        // A balanced treap over 4096 entries is far shallower than the 1000-node walk
+        CHECK(stats.walks[ListStats::GET].max < 100);
+#endif
+    }
+
+    TEST_CASE("histogram buckets and percentiles")
+    {
+        ListStats::Histogram h;
+        for (int i = 0; i < 99; ++i)
+            h.add(3);
+        h.add(1000);
+        CHECK(h.count == 100);
+        CHECK(h.max == 1000);
+        CHECK(h.mean() == 12.97); // 1297 / 100, correctly rounded
+        CHECK(h.percentile(0.5) == 3);
+        CHECK(h.percentile(0.99) == 3);
+        CHECK(h.percentile(1.0) == 1023);
+        h.add(0);
+        CHECK(h.buckets[0] == 1);
+    }
+}
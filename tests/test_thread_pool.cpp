@@ -0,0 +1,100 @@
+#include "doctest/doctest.h"
+#include "src/ThreadPool.h"
+#include <atomic>
+#include <vector>
+
+TEST_SUITE("ThreadPool")
+{
+    TEST_CASE("submit and wait run every task once")
+    {
+        ThreadPool pool(4);
+        CHECK(pool.size() == 4);
+        std::vector<std::atomic<int>> hits(1000);
+        for (std::atomic<int> &h : hits)
+            h = 0;
+        for (int i = 0; i < 1000; ++i)
+            pool.submit([&hits, i] { hits[i].fetch_add(1); });
+        pool.wait();
+        bool once = true;
+        for (std::atomic<int> &h : hits)
+            once = once && h == 1;
+        CHECK(once);
+        pool.wait(); // nothing pending: returns at once
+    }
+
+    TEST_CASE("tasks may submit more tasks")
+    {
+        ThreadPool pool(3);
+        std::atomic<int> nodes(0);
+        // Full binary tree of depth 10 built from nested submits
+        std::function<void(int)> grow = [&](int depth) {
+            nodes.fetch_add(1);
+            if (depth == 0)
+                return;
+            pool.submit([&grow, depth] { grow(depth - 1); });
+            pool.submit([&grow, depth] { grow(depth - 1); });
+        };
+        pool.submit([&grow] { grow(10); });
+        pool.wait();
+        CHECK(nodes == (1 << 11) - 1);
+    }
+
+    TEST_CASE("parallel_for covers the range and nests")
+    {
+        ThreadPool pool(4);
+        std::vector<int> squares(10000, 0);
+        pool.parallel_for(0, 10000, [&](int i) { squares[i] = i * i; });
+        bool ok = true;
+        for (int i = 0; i < 10000; ++i)
+            ok = ok && squares[i] == i * i;
+        CHECK(ok);
+
+        std::atomic<long> total(0);
+        pool.parallel_for(0, 20, [&](int i) {
+            pool.parallel_for(0, 100, [&](int j) { total.fetch_add(i * 100 + j); }, 7);
+        }, 1);
+        CHECK(total == 2000L * 1999 / 2);
+
+        int calls = 0;
+        pool.parallel_for(5, 5, [&](int) { ++calls; });
+        CHECK(calls == 0);
+    }
+
+    TEST_CASE("exceptions reach the waiting thread")
+    {
+        ThreadPool pool(2);
+        pool.submit([] { throw std::runtime_error("task failed"); });
+        CHECK_THROWS_AS(pool.wait(), std::runtime_error);
+        pool.wait(); // the failure is reported once
+
+        CHECK_THROWS_AS(pool.parallel_for(0, 100, [](int i) {
+            if (i == 42)
+                throw std::out_of_range("bad index");
+        }), std::out_of_range);
+
+        std::atomic<bool> threw(false);
+        pool.submit([&] {
+            try
+            {
+                pool.wait();
+            }
+            catch (const std::logic_error &)
+            {
+                threw = true;
+            }
+        });
+        pool.wait();
+        CHECK(threw);
+    }
+
+    TEST_CASE("destructor drains queued work")
+    {
+        std::atomic<int> done(0);
+        {
+            ThreadPool pool(2);
+            for (int i = 0; i < 100; ++i)
+                pool.submit([&done] { done.fetch_add(1); });
+        }
+        CHECK(done == 100);
+    }
+}
@@ -0,0 +1,120 @@
+#include "doctest/doctest.h"
+#include "src/UnrolledLinkedList.h"
+#include <vector>
+
+TEST_SUITE("UnrolledLinkedList")
+{
+    TEST_CASE("basic operations mirror DoublyLinkedList")
+    {
+        UnrolledLinkedList<int> list;
+        CHECK(list.size() == 0);
+        CHECK(list.toString() == "[]");
+        CHECK_THROWS_AS(list.get(0), std::out_of_range);
+        CHECK_THROWS_AS(list.deleteAt(0), std::out_of_range);
+        CHECK_THROWS_AS(list.insertAt(1, 5), std::out_of_range);
+
+        list.insertAtTail(2);
+        list.insertAtHead(1);
+        list.insertAt(2, 3);                 // [1,2,3]
+        CHECK(list.toString() == "[1, 2, 3]");
+        CHECK(list.indexOf(3) == 2);
+        CHECK(list.contains(1));
+        CHECK_FALSE(list.contains(4));
+
+        list.get(1) = 20;
+        list.deleteAt(0);                    // [20,3]
+        CHECK(list.get(0) == 20);
+        CHECK(list.size() == 2);
+    }
+
+    TEST_CASE("many elements span several nodes")
+    {
+        const int N = UnrolledLinkedList<int>::CAPACITY * 5 + 3;
+        UnrolledLinkedList<int> list;
+        for (int i = 0; i < N; ++i) list.insertAtTail(i);
+        CHECK(list.size() == N);
+        for (int i = 0; i < N; ++i) REQUIRE(list.get(i) == i);
+        CHECK(list.indexOf(N - 1) == N - 1);
+
+        int expected = 0;
+        for (int x : list) CHECK(x == expected++);
+        CHECK(expected == N);
+
+        auto it = list.end();
+        for (int i = N - 1; i >= 0; --i) { --it; REQUIRE(*it == i); }
+        CHECK(it == list.begin());
+
+        list.reverse();
+        for (int i = 0; i < N; ++i) REQUIRE(list.get(i) == N - 1 - i);
+        for (int i = 0; i < N; ++i) list.deleteAt(0);
+        CHECK(list.size() == 0);
+        CHECK(list.begin() == list.end());
+    }
+
+    TEST_CASE("Unrolled random inserts and deletes match a vector model")
+    {
+        UnrolledLinkedList<std::string> list;
+        std::vector<std::string> model;
+        unsigned state = 7;
+        auto next = [&state]() { state = state * 1103515245u + 12345u; return int(state >> 8); };
+
+        for (int step = 0; step < 2000; ++step)
+        {
+            if (next() % 3 != 0 || model.empty())
+            {
+                int pos = next() % (int(model.size()) + 1);
+                list.insertAt(pos, std::to_string(step));
+                model.insert(model.begin() + pos, std::to_string(step));
+            }
+            else
+            {
+                int pos = next() % int(model.size());
+                list.deleteAt(pos);
+                model.erase(model.begin() + pos);
+            }
+        }
+        REQUIRE(list.size() == int(model.size()));
+        int idx = 0;
+        for (const std::string &s : list) REQUIRE(s == model[idx++]);
+        for (int i = 0; i < list.size(); ++i) REQUIRE(list.get(i) == model[i]);
+    }
+
+    TEST_CASE("copy, move and Point formatting")
+    {
+        UnrolledLinkedList<Point> list;
+        list.insertAtTail(Point(9, 0));
+        list.insertAtTail(Point(8, 1));
+
+        UnrolledLinkedList<Point> copy(list);
+        list.deleteAt(0);
+        CHECK(copy.size() == 2);
+        CHECK(copy.indexOf(Point(8, 1)) == 1);
+
+        UnrolledLinkedList<Point> moved(std::move(copy));
+        CHECK(copy.size() == 0);
+        CHECK(moved.toString() == "[(9,0,0), (8,1,0)]");
+
+        auto conv = [](Point &p) { return std::to_string(int(p.getX())); };
+        CHECK(moved.toString(conv) == "[9, 8]");
+
+        list = moved;
+        CHECK(list.size() == 2);
+        moved = std::move(list);
+        CHECK(list.size() == 0);
+        CHECK(moved.get(1) == Point(8, 1));
+    }
+}
+
+TEST_SUITE("UnrolledLinkedList Buffered toString")
+{
+    TEST_CASE("toString(out) matches toString() across several nodes")
+    {
+        UnrolledLinkedList<double> list;
+        for (int i = 0; i < 100; ++i)
+            list.insertAtTail(i / 8.0);
+        string out = ">";
+        list.toString(out);
+        CHECK(out == ">" + list.toString());
+        CHECK(list.toString().substr(0, 17) == "[0, 0.125, 0.25, ");
+    }
+}
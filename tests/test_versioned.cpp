@@ -0,0 +1,109 @@
+#include "doctest/doctest.h"
+#include "src/VersionedList.h"
+#include <cstdint>
+#include <vector>
+
+TEST_SUITE("VersionedList")
+{
+    TEST_CASE("every edit makes a version and old versions stay readable")
+    {
+        VersionedList<char> text;
+        CHECK(text.versionCount() == 1);
+        for (char ch : string("helo"))
+            text.insertAtTail(ch);
+        text.insertAt(3, 'l');
+        text.deleteAt(0);
+        text.insertAtHead('H');
+        CHECK(text.toString() == "[H, e, l, l, o]");
+        CHECK(text.versionCount() == 8);
+        CHECK(text.currentVersion() == 7);
+
+        CHECK(text.version(0).empty());
+        CHECK(text.version(4).toString() == "[h, e, l, o]");
+        CHECK(text.version(5).get(3) == 'l');
+        CHECK(text.version(6).toString() == "[e, l, l, o]");
+        string word;
+        for (char ch : text.version(5))
+            word += ch;
+        CHECK(word == "hello");
+        CHECK_THROWS_AS(text.version(8), std::out_of_range);
+        CHECK_THROWS_AS(text.deleteAt(5), std::out_of_range);
+        CHECK(text.versionCount() == 8); // a rejected edit adds nothing
+    }
+
+    TEST_CASE("undo and redo walk the history and a new edit drops the redo branch")
+    {
+        VersionedList<int> list;
+        CHECK_FALSE(list.undo());
+        list.insertAtTail(1);
+        list.insertAtTail(2);
+        list.set(0, 10);
+        CHECK(list.toString() == "[10, 2]");
+
+        CHECK(list.undo());
+        CHECK(list.toString() == "[1, 2]");
+        CHECK(list.undo());
+        CHECK(list.toString() == "[1]");
+        CHECK(list.canRedo());
+        CHECK(list.redo());
+        CHECK(list.get(1) == 2);
+
+        list.insertAtHead(0); // replaces the undone set()
+        CHECK_FALSE(list.canRedo());
+        CHECK(list.versionCount() == 4);
+        CHECK(list.toString() == "[0, 1, 2]");
+        list.clear();
+        CHECK(list.empty());
+        CHECK(list.undo());
+        CHECK(list.indexOf(2) == 2);
+
+        list.compact();
+        CHECK(list.versionCount() == 1);
+        CHECK_FALSE(list.canUndo());
+        CHECK(list.toString() == "[0, 1, 2]");
+    }
+
+    TEST_CASE("random edits: every version matches a saved vector copy")
+    {
+        VersionedList<int> list;
+        std::vector<std::vector<int>> models(1);
+        std::uint32_t seed = 5;
+        for (int step = 0; step < 3000; ++step)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            std::vector<int> model = models.back();
+            int size = int(model.size());
+            int pos = int((seed >> 8) % std::uint32_t(size + 1));
+            if (size == 0 || (seed >> 29) < 5)
+            {
+                list.insertAt(pos, step);
+                model.insert(model.begin() + pos, step);
+            }
+            else
+            {
+                pos %= size;
+                list.deleteAt(pos);
+                model.erase(model.begin() + pos);
+            }
+            models.push_back(model);
+        }
+
+        REQUIRE(list.versionCount() == int(models.size()));
+        bool same = true;
+        for (int v = 0; v < list.versionCount() && same; v += 7)
+        {
+            auto version = list.version(v);
+            same = version.size() == int(models[v].size());
+            int i = 0;
+            for (int value : version)
+                same = same && value == models[v][i++];
+        }
+        CHECK(same);
+        while (list.undo())
+        {
+        }
+        CHECK(list.empty());
+        list.redo();
+        CHECK(list.size() == 1);
+    }
+}
@@ -24,6 +24,8 @@ public:
 
     Point(const Point &other) : x(other.x), y(other.y), z(other.z) {}
 
+    Point &operator=(const Point &other) = default;
+
     double getX() const { return x; }
 
     double getY() const { return y; }